@@ -0,0 +1,86 @@
+#include "FakeServer.h"
+
+#include <QtCore/QMutexLocker>
+
+#include <QtNetwork/QHostAddress>
+
+FakeServer::FakeServer()
+    : delay(0), port(0)
+{
+    // The keep-alive probe of AmcpConnection.
+    this->responses.insert("VERSION", "201 VERSION OK\r\n2.0.7.0 Stable\r\n");
+}
+
+FakeServer::~FakeServer()
+{
+    QThread::quit();
+    QThread::wait();
+}
+
+void FakeServer::setResponse(const QByteArray& command, const QByteArray& response)
+{
+    this->responses.insert(command, response);
+}
+
+void FakeServer::setDelay(int delay)
+{
+    this->delay = delay;
+}
+
+int FakeServer::getDelay() const
+{
+    return this->delay;
+}
+
+bool FakeServer::startListening()
+{
+    QThread::start();
+    this->listening.acquire();
+
+    return this->port != 0;
+}
+
+quint16 FakeServer::getPort() const
+{
+    return this->port;
+}
+
+QList<QByteArray> FakeServer::takeCommands()
+{
+    QMutexLocker locker(&this->mutex);
+
+    QList<QByteArray> commands = this->commands;
+    this->commands.clear();
+
+    return commands;
+}
+
+QByteArray FakeServer::respond(const QByteArray& command)
+{
+    {
+        QMutexLocker locker(&this->mutex);
+        this->commands.append(command);
+    }
+
+    if (this->responses.contains(command))
+        return this->responses.value(command);
+
+    const int first = command.indexOf(' ');
+    const int second = (first < 0) ? -1 : command.indexOf(' ', first + 1);
+    if (second > 0 && this->responses.contains(command.left(second)))
+        return this->responses.value(command.left(second));
+
+    return "202 " + command.left((first < 0) ? command.length() : first) + " OK\r\n";
+}
+
+void FakeServer::run()
+{
+    FakeServerListener listener(*this);
+    if (listener.listen(QHostAddress::LocalHost, 0))
+        this->port = listener.serverPort();
+
+    this->listening.release();
+
+    if (this->port != 0)
+        QThread::exec();
+}
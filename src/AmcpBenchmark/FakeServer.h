@@ -0,0 +1,130 @@
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QPointer>
+#include <QtCore/QQueue>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
+
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+
+// Stands in for a CasparCG server on 127.0.0.1. Commands are answered with the response set for them,
+// everything else gets a one line OK. Runs in its own thread so it never competes with the event loop
+// being measured. The responses have to be set before the server is started.
+class FakeServer : public QThread
+{
+    public:
+        explicit FakeServer();
+        virtual ~FakeServer();
+
+        // The response to a command, looked up by the whole command first and then by its first two words,
+        // so "THUMBNAIL RETRIEVE" answers every thumbnail.
+        void setResponse(const QByteArray& command, const QByteArray& response);
+
+        // Every response is held back for this long, in milliseconds, the order of the responses is kept.
+        void setDelay(int delay);
+        int getDelay() const;
+
+        bool startListening();
+        quint16 getPort() const;
+
+        // Every command received since the last call, in the order they arrived.
+        QList<QByteArray> takeCommands();
+
+        QByteArray respond(const QByteArray& command);
+
+    protected:
+        virtual void run();
+
+    private:
+        int delay;
+        quint16 port;
+        QSemaphore listening;
+        QHash<QByteArray, QByteArray> responses;
+
+        QMutex mutex;
+        QList<QByteArray> commands;
+};
+
+// Lives in the thread of a FakeServer, reads the commands of every client and writes the responses.
+class FakeServerListener : public QTcpServer
+{
+    Q_OBJECT
+
+    public:
+        explicit FakeServerListener(FakeServer& server)
+            : server(server)
+        {
+            this->clock.start();
+
+            this->replyTimer.setSingleShot(true);
+            QObject::connect(&this->replyTimer, SIGNAL(timeout()), this, SLOT(writeReplies()));
+
+            QObject::connect(this, SIGNAL(newConnection()), this, SLOT(acceptConnection()));
+        }
+
+    private:
+        struct FakeServerReply
+        {
+            QPointer<QTcpSocket> socket;
+            qint64 due;
+            QByteArray response;
+        };
+
+        FakeServer& server;
+        QElapsedTimer clock;
+        QTimer replyTimer;
+        QQueue<FakeServerReply> replies;
+
+        Q_SLOT void acceptConnection()
+        {
+            while (QTcpServer::hasPendingConnections())
+            {
+                QTcpSocket* socket = QTcpServer::nextPendingConnection();
+                socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+
+                QObject::connect(socket, SIGNAL(readyRead()), this, SLOT(readCommands()));
+                QObject::connect(socket, SIGNAL(disconnected()), socket, SLOT(deleteLater()));
+            }
+        }
+
+        Q_SLOT void readCommands()
+        {
+            QTcpSocket* socket = qobject_cast<QTcpSocket*>(QObject::sender());
+            while (socket->canReadLine())
+            {
+                const QByteArray response = this->server.respond(socket->readLine().trimmed());
+                if (this->server.getDelay() == 0)
+                {
+                    socket->write(response);
+                    continue;
+                }
+
+                FakeServerReply reply = { socket, this->clock.elapsed() + this->server.getDelay(), response };
+                this->replies.enqueue(reply);
+
+                if (!this->replyTimer.isActive())
+                    this->replyTimer.start(this->server.getDelay());
+            }
+        }
+
+        Q_SLOT void writeReplies()
+        {
+            const qint64 now = this->clock.elapsed();
+            while (!this->replies.isEmpty() && this->replies.head().due <= now)
+            {
+                const FakeServerReply reply = this->replies.dequeue();
+                if (!reply.socket.isNull())
+                    reply.socket->write(reply.response);
+            }
+
+            if (!this->replies.isEmpty())
+                this->replyTimer.start(static_cast<int>(this->replies.head().due - now));
+        }
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "DeviceManager.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QTimer>
+
+// Stands in for a rundown item in a group, executes the way RundownGeometryWidget does when the group is played.
+class GroupChild : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit GroupChild(int videolayer, int delay, QObject* parent = 0)
+            : QObject(parent), videolayer(videolayer), executed(false)
+        {
+            this->executeTimer.setSingleShot(true);
+            this->executeTimer.setInterval(delay);
+
+            QObject::connect(&this->executeTimer, SIGNAL(timeout()), this, SLOT(executePlay()));
+        }
+
+        bool isExecuted() const { return this->executed; }
+
+        void execute()
+        {
+            if (this->executeTimer.interval() == 0 && DeviceManager::getInstance().isDeferringMixer())
+                executePlay();
+            else
+                this->executeTimer.start();
+        }
+
+        Q_SLOT void executePlay()
+        {
+            foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
+            {
+                if (deviceShadow->isConnected())
+                    deviceShadow->setGeometry(1, this->videolayer, 0.1f, 0.1f, 0.8f, 0.8f, 0, "linear");
+            }
+
+            this->executed = true;
+        }
+
+    private:
+        int videolayer;
+        bool executed;
+        QTimer executeTimer;
+};
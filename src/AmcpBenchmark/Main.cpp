@@ -0,0 +1,719 @@
+#include "FakeServer.h"
+#include "GroupChild.h"
+#include "ResponseCounter.h"
+#include "StallProbe.h"
+
+#include "CasparConnection.h"
+#include "CasparDevice.h"
+
+#include "DatabaseManager.h"
+#include "DeviceManager.h"
+
+#include "Models/DeviceModel.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QEventLoop>
+#include <QtCore/QFile>
+#include <QtCore/QList>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+#include <QtCore/QtAlgorithms>
+
+#include <QtSql/QSqlDatabase>
+
+struct BenchmarkOptions
+{
+    int clips;
+    int templates;
+    int channels;
+    int thumbnail;
+    int iterations;
+    int delay;
+    int commands;
+    int probe;
+    int encodes;
+    int shadows;
+    int items;
+};
+
+void printUsage(QTextStream& stream)
+{
+    stream << "Usage: amcpbenchmark [-clips 20000] [-templates 2000] [-channels 4] [-thumbnail 64] [-iterations 10]" << endl
+           << "                     [-delay 20] [-commands 200] [-probe 1] [-encodes 100000]" << endl
+           << "                     [-shadows 8] [-items 20]" << endl
+           << endl
+           << "Starts a stand-in for a server on 127.0.0.1 and replays canned responses through CasparDevice: a CLS" << endl
+           << "with -clips clips, a TLS with -templates templates, an INFO for -channels channels and a THUMBNAIL" << endl
+           << "RETRIEVE of -thumbnail KB. Every response is timed from the command until the device has its reply." << endl
+           << "The GUI thread is probed for stalls while the CLS and the TLS are parsed, with the connection on its" << endl
+           << "own thread and on the GUI thread the way it was before." << endl
+           << "A second stand-in holds every reply back for -delay ms while -commands commands are sent one at a time," << endl
+           << "the latency statistics of the device have to report the delay. With -probe 1 the keep-alive probe is" << endl
+           << "awaited as well, which takes about ten seconds." << endl
+           << "PLAY, MIXER FILL and CG ADD are encoded -encodes times each by a disconnected device, which drops" << endl
+           << "the command once it is encoded, and with the QString formatting the device used before AmcpEncoder." << endl
+           << "A group take of -items items is timed against -shadows shadow servers loaded by DeviceManager from a" << endl
+           << "temporary database, through getShadowDevices() and with the lookups every item made before." << endl
+           << "Finally a group is played inside a deferred mixer block and the stand-in checks that the transforms" << endl
+           << "of the children without a delay arrive with DEFER in front of a single MIXER COMMIT." << endl;
+}
+
+QString formatTime(qint64 nanoseconds)
+{
+    return QString("%1 ms").arg(nanoseconds / 1000000.0, 0, 'f', 2);
+}
+
+qint64 getMedian(QVector<qint64> samples)
+{
+    qSort(samples);
+
+    return samples.at(samples.count() / 2);
+}
+
+// Clip names the way a server lists them, in folders.
+QByteArray createMediaList(int clips)
+{
+    QByteArray response("200 CLS OK\r\n");
+    for (int i = 0; i < clips; i++)
+        response += QString("\"FOLDER%1/CLIP_%2\"  MOVIE  6445960 20121101160514 643 1/25\r\n")
+                    .arg(i % 100).arg(i, 7, 10, QChar('0')).toUtf8();
+
+    return response + "\r\n";
+}
+
+QByteArray createTemplateList(int templates)
+{
+    QByteArray response("200 TLS OK\r\n");
+    for (int i = 0; i < templates; i++)
+        response += QString("\"FOLDER%1/TEMPLATE_%2\"  61364 20121101160514\r\n").arg(i % 20).arg(i, 5, 10, QChar('0')).toUtf8();
+
+    return response + "\r\n";
+}
+
+QByteArray createInfo(int channels)
+{
+    QByteArray response("200 INFO OK\r\n");
+    for (int i = 1; i <= channels; i++)
+        response += QString("%1 1080i5000 PLAYING\r\n").arg(i).toUtf8();
+
+    return response + "\r\n";
+}
+
+// A base64 encoded PNG is a single line.
+QByteArray createThumbnail(int size)
+{
+    QByteArray data(size * 1024, '\0');
+    for (int i = 0; i < data.size(); i++)
+        data[i] = static_cast<char>((i * 7919) >> 3);
+
+    return "201 THUMBNAIL RETRIEVE OK\r\n" + data.toBase64() + "\r\n";
+}
+
+// Runs the event loop until the device has the reply to the ticket, false after ten seconds without it.
+bool waitForTicket(const ResponseCounter& counter, int ticket)
+{
+    // Wakes the event loop up to check the time when nothing arrives.
+    QTimer wakeUp;
+    wakeUp.start(100);
+
+    QElapsedTimer clock;
+    clock.start();
+    while (!counter.isCompleted(ticket))
+    {
+        if (clock.elapsed() > 10000)
+            return false;
+
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    }
+
+    return true;
+}
+
+bool waitForConnection(const ResponseCounter& counter)
+{
+    // Wakes the event loop up to check the time when nothing arrives.
+    QTimer wakeUp;
+    wakeUp.start(100);
+
+    QElapsedTimer clock;
+    clock.start();
+    while (!counter.isConnected())
+    {
+        if (clock.elapsed() > 10000)
+            return false;
+
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    }
+
+    return true;
+}
+
+// One of the responses, replayed -iterations times. The items are counted to make sure the whole response was parsed.
+// The command goes through sendCommand(), it is encoded and sent the same way as from refreshMedia() and the like.
+bool benchmarkResponse(const BenchmarkOptions& options, CasparDevice& device, ResponseCounter& counter, const QString& description,
+                       const QString& command, int size, int items, QTextStream& stream)
+{
+    QVector<qint64> samples;
+
+    QElapsedTimer timer;
+    for (int i = 0; i < options.iterations; i++)
+    {
+        timer.start();
+
+        const int ticket = device.sendCommand(command);
+        if (!waitForTicket(counter, ticket))
+        {
+            stream << QString("%1: no reply").arg(description) << endl;
+            return false;
+        }
+
+        samples.append(timer.nsecsElapsed());
+    }
+
+    const qint64 median = getMedian(samples);
+
+    stream << QString("%1 (%2 KB): %3 (median of %4), %5 MB/s")
+              .arg(description).arg(size / 1024).arg(formatTime(median)).arg(options.iterations)
+              .arg((median > 0) ? size * 1000.0 / median : 0.0, 0, 'f', 1) << endl;
+
+    if (counter.getItems() != items)
+    {
+        stream << QString("%1: expected %2 items, got %3").arg(description).arg(items).arg(counter.getItems()) << endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool benchmarkReplay(const BenchmarkOptions& options, FakeServer& server, QTextStream& stream)
+{
+    CasparDevice device("127.0.0.1", server.getPort());
+    ResponseCounter counter(device);
+
+    device.connectDevice();
+    if (!waitForConnection(counter))
+    {
+        stream << QString("Failed to connect to 127.0.0.1:%1").arg(server.getPort()) << endl;
+        return false;
+    }
+
+    bool succeeded = true;
+    succeeded &= benchmarkResponse(options, device, counter, QString("CLS, %1 clips").arg(options.clips),
+                                   "CLS", createMediaList(options.clips).size(), options.clips, stream);
+    succeeded &= benchmarkResponse(options, device, counter, QString("TLS, %1 templates").arg(options.templates),
+                                   "TLS", createTemplateList(options.templates).size(), options.templates, stream);
+    succeeded &= benchmarkResponse(options, device, counter, QString("INFO, %1 channels").arg(options.channels),
+                                   "INFO", createInfo(options.channels).size(), options.channels, stream);
+    succeeded &= benchmarkResponse(options, device, counter, QString("THUMBNAIL RETRIEVE, %1 KB PNG").arg(options.thumbnail),
+                                   "THUMBNAIL RETRIEVE \"FOLDER1/CLIP_0000001\"",
+                                   createThumbnail(options.thumbnail).size(), 1, stream);
+
+    device.disconnectDevice();
+
+    return succeeded;
+}
+
+void printStall(const QString& description, const StallProbe& probe, QTextStream& stream)
+{
+    stream << QString("%1: longest stall %2, 99th percentile %3")
+              .arg(description).arg(formatTime(probe.getMaximum())).arg(formatTime(probe.getPercentile(99))) << endl;
+}
+
+// A 1 ms timer on the GUI thread while the largest responses are parsed. The connection on the GUI thread
+// is the way CasparDevice worked before AmcpThread, it parsed and built the models in readyRead().
+bool benchmarkStall(FakeServer& server, QTextStream& stream)
+{
+    const char* const COMMANDS[] = { "CLS", "TLS" };
+
+    bool succeeded = true;
+    StallProbe probe;
+
+    {
+        CasparDevice device("127.0.0.1", server.getPort());
+        ResponseCounter counter(device);
+
+        device.connectDevice();
+        if (!waitForConnection(counter))
+        {
+            stream << QString("Failed to connect to 127.0.0.1:%1").arg(server.getPort()) << endl;
+            return false;
+        }
+
+        for (int i = 0; i < 2; i++)
+        {
+            probe.start();
+            succeeded &= waitForTicket(counter, device.sendCommand(COMMANDS[i]));
+            probe.stop();
+
+            printStall(QString("%1 on the connection thread").arg(COMMANDS[i]), probe, stream);
+        }
+
+        device.disconnectDevice();
+    }
+
+    {
+        CasparConnection connection("127.0.0.1", server.getPort());
+        ResponseCounter counter(connection);
+
+        connection.connectToServer();
+        if (!waitForConnection(counter))
+        {
+            stream << QString("Failed to connect to 127.0.0.1:%1").arg(server.getPort()) << endl;
+            return false;
+        }
+
+        for (int i = 0; i < 2; i++)
+        {
+            probe.start();
+            connection.writeMessages(QByteArray(COMMANDS[i]) + "\r\n", QList<int>() << i + 1);
+            succeeded &= waitForTicket(counter, i + 1);
+            probe.stop();
+
+            printStall(QString("%1 on the GUI thread").arg(COMMANDS[i]), probe, stream);
+        }
+
+        connection.disconnectFromServer();
+    }
+
+    return succeeded;
+}
+
+// The latency histogram reports the upper bound of a bucket, which is up to 25% above the round trip.
+// Two milliseconds are allowed for the timers of the server and the event loops on top of that.
+bool checkLatency(const QString& description, qint64 latency, int delay, QTextStream& stream)
+{
+    const qint64 minimum = delay * 1000;
+    const qint64 maximum = (delay * 1000 + 2000) * 5 / 4;
+    const bool succeeded = latency >= minimum && latency <= maximum;
+
+    stream << QString("%1: %2 (expected %3 to %4)%5")
+              .arg(description).arg(formatTime(latency * 1000)).arg(formatTime(minimum * 1000)).arg(formatTime(maximum * 1000))
+              .arg(succeeded ? "" : ", FAILED") << endl;
+
+    return succeeded;
+}
+
+// The commands are sent one at a time so every round trip is the delay of the server and nothing else.
+bool benchmarkLatency(const BenchmarkOptions& options, QTextStream& stream)
+{
+    FakeServer server;
+    server.setDelay(options.delay);
+
+    if (!server.startListening())
+    {
+        stream << "Failed to listen on 127.0.0.1" << endl;
+        return false;
+    }
+
+    CasparDevice device("127.0.0.1", server.getPort());
+    ResponseCounter counter(device);
+
+    device.connectDevice();
+    if (!waitForConnection(counter))
+    {
+        stream << QString("Failed to connect to 127.0.0.1:%1").arg(server.getPort()) << endl;
+        return false;
+    }
+
+    device.resetLatencyStatistics();
+
+    for (int i = 0; i < options.commands; i++)
+    {
+        if (!waitForTicket(counter, device.sendCommand("PLAY 1-10")))
+        {
+            stream << QString("PLAY with a %1 ms delay: no reply").arg(options.delay) << endl;
+            return false;
+        }
+    }
+
+    AmcpDevice::AmcpLatencyStatistics statistics = device.getLatencyStatistics();
+
+    stream << QString("%1 commands with a %2 ms delay, %3 failed").arg(statistics.samples).arg(options.delay).arg(statistics.failures) << endl;
+
+    bool succeeded = statistics.samples == options.commands && statistics.failures == 0;
+    succeeded &= checkLatency("Median", statistics.median, options.delay, stream);
+    succeeded &= checkLatency("99th percentile", statistics.percentile99, options.delay, stream);
+
+    if (options.probe != 0)
+    {
+        // A probe goes out every ten seconds unless a command is in flight.
+        QTimer wakeUp;
+        wakeUp.start(100);
+
+        QElapsedTimer clock;
+        clock.start();
+        while (device.getLatencyStatistics().probes == 0 && clock.elapsed() < 15000)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        statistics = device.getLatencyStatistics();
+        if (statistics.probes == 0)
+        {
+            stream << "Keep-alive probe: none sent, FAILED" << endl;
+            succeeded = false;
+        }
+        else
+        {
+            succeeded &= checkLatency("Keep-alive probe", statistics.lastProbe, options.delay, stream);
+        }
+    }
+
+    device.disconnectDevice();
+
+    return succeeded;
+}
+
+// The commands the way CasparDevice formatted them before AmcpEncoder, including the conversion in writeMessage().
+QByteArray formatMessage(const QString& message)
+{
+    return QString("%1\r\n").arg(message.trimmed()).toUtf8();
+}
+
+QByteArray formatPlayVideo(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                           const QString& easing, const QString& direction, int seek, int length, bool loop)
+{
+    return formatMessage(QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7 %8 %9 %10")
+                         .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing).arg(direction)
+                         .arg((seek > 0) ? QString("SEEK %1").arg(seek) : "")
+                         .arg((length > 0) ? QString("LENGTH %1").arg(length) : "")
+                         .arg((loop == true) ? "LOOP" : ""));
+}
+
+QByteArray formatGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                          int duration, const QString& easing, bool defer)
+{
+    return formatMessage(QString("MIXER %1-%2 FILL %3 %4 %5 %6 %7 %8 %9")
+                         .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX).arg(scaleY)
+                         .arg(duration).arg(easing).arg((defer == true) ? "DEFER" : ""));
+}
+
+QByteArray formatTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad, const QString& data)
+{
+    return formatMessage(QString("CG %1-%2 ADD %3 %4 \"%5\" \"%6\"")
+                         .arg(channel).arg(videolayer).arg(flashlayer).arg(name).arg((playOnLoad == true) ? "1" : "0").arg(data));
+}
+
+void printEncoding(const QString& description, qint64 before, qint64 after, int count, QTextStream& stream)
+{
+    stream << QString("Encoding %1: %2 ns per command, %3 ns with QString formatting")
+              .arg(description).arg(after / count).arg(before / count) << endl;
+}
+
+// A disconnected device encodes the command and drops it in writeMessage(), so only the encoding is timed.
+bool benchmarkEncoding(const BenchmarkOptions& options, QTextStream& stream)
+{
+    CasparDevice device("127.0.0.1", 5250);
+
+    const QString name("FOLDER1/CLIP_0000001");
+    const QString transition("MIX");
+    const QString easing("easeinsine");
+    const QString direction("RIGHT");
+    const QString data("<templateData><componentData id=\\\"f0\\\"><data id=\\\"text\\\" value=\\\"Name\\\"/></componentData></templateData>");
+
+    // The sizes of the old formatting are added up so the compiler can not drop it, the disconnected device returns 0.
+    qint64 bytes = 0;
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < options.encodes; i++)
+        bytes += formatPlayVideo(1, 10, name, transition, 12, easing, direction, i, 0, true).size();
+
+    qint64 before = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int i = 0; i < options.encodes; i++)
+        bytes += device.playVideo(1, 10, name, transition, 12, easing, direction, i, 0, true, false);
+
+    printEncoding("PLAY", before, timer.nsecsElapsed(), options.encodes, stream);
+
+    timer.restart();
+    for (int i = 0; i < options.encodes; i++)
+        bytes += formatGeometry(1, 10, i * 0.001f, 0.25f, 0.5f, 0.5f, 12, easing, true).size();
+
+    before = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int i = 0; i < options.encodes; i++)
+        bytes += device.setGeometry(1, 10, i * 0.001f, 0.25f, 0.5f, 0.5f, 12, easing, true);
+
+    printEncoding("MIXER FILL", before, timer.nsecsElapsed(), options.encodes, stream);
+
+    timer.restart();
+    for (int i = 0; i < options.encodes; i++)
+        bytes += formatTemplate(1, 20, i % 10, name, true, data).size();
+
+    before = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int i = 0; i < options.encodes; i++)
+        bytes += device.addTemplate(1, 20, i % 10, name, true, data);
+
+    printEncoding("CG ADD", before, timer.nsecsElapsed(), options.encodes, stream);
+
+    return bytes > 0;
+}
+
+// Runs the event loop until every shadow device is connected and, with replies set, has had the replies to its commands.
+bool waitForShadowDevices(bool replies)
+{
+    QTimer wakeUp;
+    wakeUp.start(100);
+
+    QElapsedTimer clock;
+    clock.start();
+    while (clock.elapsed() < 10000)
+    {
+        bool done = true;
+        foreach (const QSharedPointer<CasparDevice>& device, DeviceManager::getInstance().getShadowDevices())
+            done &= device->isConnected() && (!replies || device->getPendingCount() == 0);
+
+        if (done)
+            return true;
+
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    }
+
+    return false;
+}
+
+// How every rundown item found the shadow servers before getShadowDevices(), per command.
+void takeBefore(int items)
+{
+    for (int item = 0; item < items; item++)
+    {
+        foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+        {
+            if (model.getShadow() == "No")
+                continue;
+
+            const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
+            if (deviceShadow != NULL && deviceShadow->isConnected())
+                deviceShadow->setGeometry(1, 10 + item, 0.1f, 0.1f, 0.8f, 0.8f, 12, "easeinsine", false);
+        }
+    }
+}
+
+void takeAfter(int items)
+{
+    for (int item = 0; item < items; item++)
+    {
+        foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
+        {
+            if (deviceShadow->isConnected())
+                deviceShadow->setGeometry(1, 10 + item, 0.1f, 0.1f, 0.8f, 0.8f, 12, "easeinsine", false);
+        }
+    }
+}
+
+// Only the time spent in the take is counted, the commands are sent and answered between the takes.
+qint64 benchmarkTake(const BenchmarkOptions& options, void (*take)(int))
+{
+    QVector<qint64> samples;
+
+    QElapsedTimer timer;
+    for (int i = 0; i < options.iterations; i++)
+    {
+        timer.start();
+        take(options.items);
+        samples.append(timer.nsecsElapsed());
+
+        if (!waitForShadowDevices(true))
+            return -1;
+    }
+
+    return getMedian(samples);
+}
+
+// The group take of RundownTreeWidget: three children without a delay and one with. Only the first shadow device
+// sends, the stand-in can not tell the connections apart and the order is only defined per connection.
+bool checkDeferredGroup(FakeServer& server, QTextStream& stream)
+{
+    const QList<QSharedPointer<CasparDevice> >& devices = DeviceManager::getInstance().getShadowDevices();
+    for (int i = 1; i < devices.count(); i++)
+        devices.at(i)->setDisableCommands(true);
+
+    server.takeCommands();
+
+    GroupChild first(10, 0);
+    GroupChild second(11, 0);
+    GroupChild third(12, 0);
+    GroupChild delayed(13, 50);
+
+    DeviceManager::getInstance().beginDeferredMixer();
+
+    first.execute();
+    second.execute();
+    third.execute();
+    delayed.execute();
+
+    DeviceManager::getInstance().commitDeferredMixer();
+
+    QTimer wakeUp;
+    wakeUp.start(100);
+
+    QElapsedTimer clock;
+    clock.start();
+    while (!delayed.isExecuted() && clock.elapsed() < 10000)
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+    bool succeeded = delayed.isExecuted() && waitForShadowDevices(true);
+
+    for (int i = 1; i < devices.count(); i++)
+        devices.at(i)->setDisableCommands(false);
+
+    QList<QByteArray> commands;
+    foreach (const QByteArray& command, server.takeCommands())
+    {
+        if (command.startsWith("MIXER "))
+            commands.append(command);
+    }
+
+    // MIXER 1-10, 1-11 and 1-12 FILL with DEFER, MIXER 1 COMMIT and then MIXER 1-13 FILL without DEFER.
+    succeeded &= commands.count() == 5 && commands.at(3) == "MIXER 1 COMMIT" && !commands.at(4).endsWith(" DEFER");
+    for (int i = 0; succeeded && i < 3; i++)
+        succeeded &= commands.at(i).startsWith(QString("MIXER 1-%1 FILL ").arg(10 + i).toUtf8()) && commands.at(i).endsWith(" DEFER");
+
+    if (succeeded)
+    {
+        stream << "Deferred group take: 3 transforms committed together, 1 delayed after the commit" << endl;
+    }
+    else
+    {
+        stream << "Deferred group take: FAILED, the server got" << endl;
+        foreach (const QByteArray& command, commands)
+            stream << "    " << command << endl;
+    }
+
+    return succeeded;
+}
+
+bool benchmarkShadowTake(const BenchmarkOptions& options, FakeServer& server, QTextStream& stream)
+{
+    const QString databaseLocation = QDir::temp().filePath(QString("amcpbenchmark-%1.s3db").arg(QCoreApplication::applicationPid()));
+
+    QSqlDatabase database = QSqlDatabase::addDatabase("QSQLITE");
+    database.setDatabaseName(databaseLocation);
+    if (!database.open())
+    {
+        stream << QString("Unable to open %1").arg(databaseLocation) << endl;
+        return false;
+    }
+
+    DatabaseManager::getInstance().initialize();
+
+    for (int i = 0; i < options.shadows; i++)
+        DatabaseManager::getInstance().insertDevice(DeviceModel(0, QString("Shadow %1").arg(i + 1), "127.0.0.1", server.getPort(),
+                                                                "", "", "", "", "Yes", 1, "PAL"));
+
+    DeviceManager::getInstance().initialize();
+
+    bool succeeded = waitForShadowDevices(false);
+    if (!succeeded)
+    {
+        stream << QString("Failed to connect %1 shadow devices to 127.0.0.1:%2").arg(options.shadows).arg(server.getPort()) << endl;
+    }
+    else
+    {
+        const qint64 before = benchmarkTake(options, &takeBefore);
+        const qint64 after = benchmarkTake(options, &takeAfter);
+        succeeded = before >= 0 && after >= 0;
+
+        stream << QString("Group take of %1 items on %2 shadow servers: %3, %4 with getDeviceModels() (median of %5)")
+                  .arg(options.items).arg(DeviceManager::getInstance().getShadowDevices().count())
+                  .arg(formatTime(after)).arg(formatTime(before)).arg(options.iterations) << endl;
+
+        // DeviceManager is only initialized once, the group is played on the same devices.
+        succeeded &= checkDeferredGroup(server, stream);
+    }
+
+    DeviceManager::getInstance().uninitialize();
+    DatabaseManager::getInstance().uninitialize();
+    database.close();
+
+    QFile::remove(databaseLocation);
+    QFile::remove(databaseLocation + "-wal");
+    QFile::remove(databaseLocation + "-shm");
+
+    return succeeded;
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication application(argc, argv);
+    QTextStream stream(stdout);
+
+    QStringList arguments = application.arguments();
+    arguments.removeFirst();
+
+    BenchmarkOptions options = { 20000, 2000, 4, 64, 10, 20, 200, 1, 100000, 8, 20 };
+    for (int i = 0; i < arguments.count(); i++)
+    {
+        const QString& argument = arguments.at(i);
+        if (i + 1 >= arguments.count())
+        {
+            printUsage(stream);
+            return 1;
+        }
+
+        if (argument == "-clips")
+            options.clips = arguments.at(++i).toInt();
+        else if (argument == "-templates")
+            options.templates = arguments.at(++i).toInt();
+        else if (argument == "-channels")
+            options.channels = arguments.at(++i).toInt();
+        else if (argument == "-thumbnail")
+            options.thumbnail = arguments.at(++i).toInt();
+        else if (argument == "-iterations")
+            options.iterations = arguments.at(++i).toInt();
+        else if (argument == "-delay")
+            options.delay = arguments.at(++i).toInt();
+        else if (argument == "-commands")
+            options.commands = arguments.at(++i).toInt();
+        else if (argument == "-probe")
+            options.probe = arguments.at(++i).toInt();
+        else if (argument == "-encodes")
+            options.encodes = arguments.at(++i).toInt();
+        else if (argument == "-shadows")
+            options.shadows = arguments.at(++i).toInt();
+        else if (argument == "-items")
+            options.items = arguments.at(++i).toInt();
+        else
+        {
+            printUsage(stream);
+            return 1;
+        }
+    }
+
+    if (options.clips < 0 || options.templates < 0 || options.channels < 1 || options.thumbnail < 1 || options.iterations < 1 ||
+        options.delay < 0 || options.commands < 1 || options.encodes < 1 || options.shadows < 1 || options.items < 1)
+    {
+        printUsage(stream);
+        return 1;
+    }
+
+    FakeServer server;
+    server.setResponse("CLS", createMediaList(options.clips));
+    server.setResponse("TLS", createTemplateList(options.templates));
+    server.setResponse("INFO", createInfo(options.channels));
+    server.setResponse("THUMBNAIL RETRIEVE", createThumbnail(options.thumbnail));
+
+    if (!server.startListening())
+    {
+        stream << "Failed to listen on 127.0.0.1" << endl;
+        return 1;
+    }
+
+    bool succeeded = benchmarkReplay(options, server, stream);
+    succeeded &= benchmarkStall(server, stream);
+    succeeded &= benchmarkLatency(options, stream);
+    succeeded &= benchmarkEncoding(options, stream);
+    succeeded &= benchmarkShadowTake(options, server, stream);
+
+    return succeeded ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CasparDevice.h"
+
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+// Stands in for the library and the inspector, keeps what the last notification of each kind carried.
+class ResponseCounter : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit ResponseCounter(CasparDevice& device, QObject* parent = 0)
+            : QObject(parent), connected(false), lastTicket(0), lastCode(0), items(0), bytes(0)
+        {
+            QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(setConnected(CasparDevice&)));
+            QObject::connect(&device, SIGNAL(commandCompleted(int, int, qint64)), this, SLOT(setCommandCompleted(int, int, qint64)));
+            QObject::connect(&device, SIGNAL(mediaChanged(const QList<CasparMedia>&, CasparDevice&)),
+                             this, SLOT(setMedia(const QList<CasparMedia>&)));
+            QObject::connect(&device, SIGNAL(templateChanged(const QList<CasparTemplate>&, CasparDevice&)),
+                             this, SLOT(setTemplates(const QList<CasparTemplate>&)));
+            QObject::connect(&device, SIGNAL(infoChanged(const QList<QString>&, CasparDevice&)),
+                             this, SLOT(setInfo(const QList<QString>&)));
+            QObject::connect(&device, SIGNAL(thumbnailRetrieveChanged(const QString&, int, CasparDevice&)),
+                             this, SLOT(setThumbnail(const QString&)));
+        }
+
+        // Without a device, the way the connection was used on the GUI thread before it got a thread of its own.
+        explicit ResponseCounter(CasparConnection& connection, QObject* parent = 0)
+            : QObject(parent), connected(false), lastTicket(0), lastCode(0), items(0), bytes(0)
+        {
+            QObject::connect(&connection, SIGNAL(connectionStateChanged(bool)), this, SLOT(setConnected(bool)));
+            QObject::connect(&connection, SIGNAL(commandCompleted(int, int, qint64)), this, SLOT(setCommandCompleted(int, int, qint64)));
+            QObject::connect(&connection, SIGNAL(mediaChanged(const QList<CasparMedia>&)), this, SLOT(setMedia(const QList<CasparMedia>&)));
+            QObject::connect(&connection, SIGNAL(templateChanged(const QList<CasparTemplate>&)),
+                             this, SLOT(setTemplates(const QList<CasparTemplate>&)));
+        }
+
+        bool isConnected() const { return this->connected; }
+
+        // Tickets are handed out in order and the server answers in order.
+        bool isCompleted(int ticket) const { return this->lastTicket >= ticket; }
+        int getLastCode() const { return this->lastCode; }
+        int getItems() const { return this->items; }
+        int getBytes() const { return this->bytes; }
+
+        Q_SLOT void setConnected(bool connected)
+        {
+            this->connected = connected;
+        }
+
+        Q_SLOT void setConnected(CasparDevice& device)
+        {
+            this->connected = device.isConnected();
+        }
+
+        Q_SLOT void setCommandCompleted(int ticket, int code, qint64 latency)
+        {
+            Q_UNUSED(latency);
+
+            this->lastTicket = qMax(this->lastTicket, ticket);
+            this->lastCode = code;
+        }
+
+        Q_SLOT void setMedia(const QList<CasparMedia>& items)
+        {
+            this->items = items.count();
+        }
+
+        Q_SLOT void setTemplates(const QList<CasparTemplate>& items)
+        {
+            this->items = items.count();
+        }
+
+        Q_SLOT void setInfo(const QList<QString>& items)
+        {
+            this->items = items.count();
+        }
+
+        Q_SLOT void setThumbnail(const QString& data)
+        {
+            this->items = 1;
+            this->bytes = data.length();
+        }
+
+    private:
+        bool connected;
+        int lastTicket;
+        int lastCode;
+        int items;
+        int bytes;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+#include <QtCore/QtAlgorithms>
+
+// Stands in for the rest of the GUI, a 1 ms timer that records how long the event loop kept it waiting.
+class StallProbe : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit StallProbe(QObject* parent = 0)
+            : QObject(parent)
+        {
+            this->timer.setInterval(1);
+            QObject::connect(&this->timer, SIGNAL(timeout()), this, SLOT(tick()));
+        }
+
+        void start()
+        {
+            this->gaps.clear();
+            this->clock.start();
+            this->timer.start();
+        }
+
+        void stop()
+        {
+            this->timer.stop();
+        }
+
+        // Nanoseconds between two ticks, the percentile of all the gaps recorded since start().
+        qint64 getPercentile(int percentile) const
+        {
+            if (this->gaps.isEmpty())
+                return 0;
+
+            QVector<qint64> gaps = this->gaps;
+            qSort(gaps);
+
+            return gaps.at(qMin(gaps.count() - 1, gaps.count() * percentile / 100));
+        }
+
+        qint64 getMaximum() const
+        {
+            qint64 maximum = 0;
+            foreach (qint64 gap, this->gaps)
+                maximum = qMax(maximum, gap);
+
+            return maximum;
+        }
+
+        Q_SLOT void tick()
+        {
+            this->gaps.append(this->clock.nsecsElapsed());
+            this->clock.restart();
+        }
+
+    private:
+        QTimer timer;
+        QElapsedTimer clock;
+        QVector<qint64> gaps;
+};
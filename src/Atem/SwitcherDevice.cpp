@@ -3,7 +3,6 @@
 #include <QtNetwork/QHostAddress>
 
 #include <QtCore/QStringList>
-#include <QtCore/QTimer>
 
 SwitcherDevice::SwitcherDevice(const QString& address, QObject* parent)
     : QObject(parent),
@@ -24,9 +23,8 @@ void SwitcherDevice::connectDevice()
     if (this->connected)
         return;
 
+    // A single attempt, retries are up to the owner.
     this->atemConnection->connectToSwitcher(QHostAddress(this->address));
-
-    QTimer::singleShot(5000, this, SLOT(connectDevice()));
 }
 
 void SwitcherDevice::disconnectDevice()
@@ -55,8 +53,6 @@ void SwitcherDevice::setDisconnected()
     this->command = SwitcherDevice::CONNECTIONSTATE;
 
     sendNotification();
-
-    QTimer::singleShot(5000, this, SLOT(connectDevice()));
 }
 
 bool SwitcherDevice::isConnected() const
@@ -2,17 +2,44 @@
 
 #include "Shared.h"
 
-#include <QtCore/QObject>
+#include "AmcpConnection.h"
+#include "AmcpEncoder.h"
+#include "AmcpLatencyHistogram.h"
 
-#include <QtNetwork/QTcpSocket>
-#include <QtNetwork/QAbstractSocket>
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QVector>
 
 class CASPAR_EXPORT AmcpDevice : public QObject
 {
     Q_OBJECT
 
     public:
-        explicit AmcpDevice(const QString& address, int port, QObject* parent = 0);
+        struct AmcpWriteStatistics
+        {
+            int flushes; // Every flush is a single socket write.
+            int commands;
+            int coalesced;
+            qint64 bytes;
+            int lastCommands;
+            int lastBytes;
+        };
+
+        // Round trips in microseconds, from the write to the socket until the reply has been parsed.
+        struct AmcpLatencyStatistics
+        {
+            int samples;
+            int failures; // Commands and probes that never got a reply.
+            int probes;
+            qint64 lastProbe;
+            qint64 median;
+            qint64 percentile99;
+            qint64 maximum;
+        };
+
+        explicit AmcpDevice(const QString& address, int port, AmcpConnection* connection, QObject* parent = 0);
         virtual ~AmcpDevice();
 
         void disconnectDevice();
@@ -22,77 +49,91 @@ class CASPAR_EXPORT AmcpDevice : public QObject
         bool isConnected() const;
         int getPort() const;
         const QString& getAddress() const;
+        int getPendingCount() const;
+        const AmcpWriteStatistics& getWriteStatistics() const;
+        const AmcpLatencyStatistics getLatencyStatistics() const;
+        void resetLatencyStatistics();
+
+        // While a deferred block is open, MIXER transforms are sent with DEFER and every channel
+        // they touched gets a single MIXER COMMIT when the outermost block is committed.
+        void beginDeferredMixer();
+        void commitDeferredMixer();
 
         Q_SLOT void connectDevice();
 
+        Q_SIGNAL void commandCompleted(int ticket, int code, qint64 latency);
+
     protected:
         enum AmcpDeviceCommand
         {
             NONE,
-            CONNECTIONSTATE,
-            LOAD,
-            LOADBG,
-            PLAY,
-            STOP,
-            CG,
-            CLS,
-            CINF,
-            VERSION,
-            TLS,
-            INFO,
-            INFOSYSTEM,
-            DATALIST,
-            DATARETRIEVE,
-            CLEAR,
-            SET,
-            MIXER,
-            CALL,
-            REMOVE,
-            ADD,
-            SWAP,
-            STATUS,
-            ERROR,
-            THUMBNAILLIST,
-            THUMBNAILRETRIEVE
+            CONNECTIONSTATE
         };
 
-        QTcpSocket* socket;
         AmcpDeviceCommand command;
-
-        QList<QString> response;
+        AmcpConnection* connection;
 
         virtual void sendNotification() = 0;
 
         void resetDevice();
-        void writeMessage(const QString& message);
+
+        // Commands are encoded in place: writeMessage(beginMessage().token(...).integer(...)).
+        AmcpEncoder& beginMessage();
+        int writeMessage(const AmcpEncoder& encoder);
 
     private:
-        enum AmcpDeviceParserState
+        struct AmcpMessage
         {
-            ExpectingHeader,
-            ExpectingOneline,
-            ExpectingTwoline,
-            ExpectingMultiline
+            int offset;
+            int length;
+            int ticket;
+            bool superseded;
         };
 
+        struct AmcpMixerProperty
+        {
+            const char* name;
+            int length;
+            bool deferrable;
+        };
+
+        static const AmcpMixerProperty MIXER_PROPERTIES[];
+
         int port;
-        int code;
-        int state;
         bool connected;
-        QString line;
         QString address;
-        QString previousLine;
         bool disableCommands;
 
-        void parseLine(const QString& line);
-        void parseHeader(const QString& line);
-        void parseOneline(const QString& line);
-        void parseTwoline(const QString& line);
-        void parseMultiline(const QString& line);
-
-        AmcpDeviceCommand translateCommand(const QString& command);
-
-        Q_SLOT void readMessage();
-        Q_SLOT void setConnected();
-        Q_SLOT void setDisconnected();
+        // Tickets are handed out here so callers get them synchronously, the connection
+        // reports back through commandCompleted() once the server has answered.
+        int nextTicket;
+        int pendingCount;
+
+        // Commands written during the current event loop iteration. They are sent to the connection
+        // as one block when control returns to the event loop, a MIXER property that is set again
+        // before then replaces the earlier command.
+        bool flushScheduled;
+        QVector<AmcpMessage> messages;
+        QHash<QByteArray, int> coalesceIndex;
+        QHash<int, QList<int> > supersededTickets;
+        AmcpEncoder encoder;
+        AmcpWriteStatistics statistics;
+
+        AmcpLatencyHistogram latency;
+        int latencyFailures;
+        int probes;
+        qint64 lastProbe;
+
+        int deferDepth;
+        QList<int> deferredChannels;
+
+        void clearMessages();
+        void completeCommand(int ticket, int code, qint64 latency);
+
+        static const AmcpMixerProperty* findMixerProperty(const char* data, int length, int& propertyEnd);
+
+        Q_SLOT void flushMessages();
+        Q_SLOT void setConnectionState(bool connected);
+        Q_SLOT void setCommandCompleted(int ticket, int code, qint64 latency);
+        Q_SLOT void setProbeCompleted(int code, qint64 latency);
 };
@@ -0,0 +1,439 @@
+#include "AmcpConnection.h"
+
+#include <string.h>
+
+// Perfect hash table for the reply verbs, indexed by (first + second + 6 * last character) & 63.
+// Every verb the server replies with maps to its own slot, so a lookup is one hash and one memcmp.
+const AmcpConnection::AmcpCommandEntry AmcpConnection::COMMAND_TABLE[AmcpConnection::COMMAND_TABLE_SIZE] =
+{
+    { 0, 0, AmcpConnection::NONE },                                  //  0
+    { "CLS", 3, AmcpConnection::CLS },                               //  1
+    { "MIXER", 5, AmcpConnection::MIXER },                           //  2
+    { "ERROR", 5, AmcpConnection::ERROR },                           //  3
+    { 0, 0, AmcpConnection::NONE },                                  //  4
+    { "LOADBG", 6, AmcpConnection::LOADBG },                         //  5
+    { 0, 0, AmcpConnection::NONE },                                  //  6
+    { "STOP", 4, AmcpConnection::STOP },                             //  7
+    { 0, 0, AmcpConnection::NONE },                                  //  8
+    { 0, 0, AmcpConnection::NONE },                                  //  9
+    { "SWAP", 4, AmcpConnection::SWAP },                             // 10
+    { 0, 0, AmcpConnection::NONE },                                  // 11
+    { "CALL", 4, AmcpConnection::CALL },                             // 12
+    { 0, 0, AmcpConnection::NONE },                                  // 13
+    { 0, 0, AmcpConnection::NONE },                                  // 14
+    { 0, 0, AmcpConnection::NONE },                                  // 15
+    { "SET", 3, AmcpConnection::SET },                               // 16
+    { 0, 0, AmcpConnection::NONE },                                  // 17
+    { "TLS", 3, AmcpConnection::TLS },                               // 18
+    { 0, 0, AmcpConnection::NONE },                                  // 19
+    { "THUMBNAIL LIST", 14, AmcpConnection::THUMBNAILLIST },         // 20
+    { 0, 0, AmcpConnection::NONE },                                  // 21
+    { 0, 0, AmcpConnection::NONE },                                  // 22
+    { 0, 0, AmcpConnection::NONE },                                  // 23
+    { 0, 0, AmcpConnection::NONE },                                  // 24
+    { "STATUS", 6, AmcpConnection::STATUS },                         // 25
+    { 0, 0, AmcpConnection::NONE },                                  // 26
+    { 0, 0, AmcpConnection::NONE },                                  // 27
+    { 0, 0, AmcpConnection::NONE },                                  // 28
+    { "ADD", 3, AmcpConnection::ADD },                               // 29
+    { 0, 0, AmcpConnection::NONE },                                  // 30
+    { 0, 0, AmcpConnection::NONE },                                  // 31
+    { 0, 0, AmcpConnection::NONE },                                  // 32
+    { 0, 0, AmcpConnection::NONE },                                  // 33
+    { 0, 0, AmcpConnection::NONE },                                  // 34
+    { "DATA RETRIEVE", 13, AmcpConnection::DATARETRIEVE },           // 35
+    { 0, 0, AmcpConnection::NONE },                                  // 36
+    { "INFO SYSTEM", 11, AmcpConnection::INFOSYSTEM },               // 37
+    { 0, 0, AmcpConnection::NONE },                                  // 38
+    { 0, 0, AmcpConnection::NONE },                                  // 39
+    { 0, 0, AmcpConnection::NONE },                                  // 40
+    { 0, 0, AmcpConnection::NONE },                                  // 41
+    { 0, 0, AmcpConnection::NONE },                                  // 42
+    { 0, 0, AmcpConnection::NONE },                                  // 43
+    { 0, 0, AmcpConnection::NONE },                                  // 44
+    { 0, 0, AmcpConnection::NONE },                                  // 45
+    { 0, 0, AmcpConnection::NONE },                                  // 46
+    { "VERSION", 7, AmcpConnection::VERSION },                       // 47
+    { "CINF", 4, AmcpConnection::CINF },                             // 48
+    { "INFO", 4, AmcpConnection::INFO },                             // 49
+    { "PLAY", 4, AmcpConnection::PLAY },                             // 50
+    { "LOAD", 4, AmcpConnection::LOAD },                             // 51
+    { "CG", 2, AmcpConnection::CG },                                 // 52
+    { "REMOVE", 6, AmcpConnection::REMOVE },                         // 53
+    { 0, 0, AmcpConnection::NONE },                                  // 54
+    { 0, 0, AmcpConnection::NONE },                                  // 55
+    { 0, 0, AmcpConnection::NONE },                                  // 56
+    { 0, 0, AmcpConnection::NONE },                                  // 57
+    { "THUMBNAIL RETRIEVE", 18, AmcpConnection::THUMBNAILRETRIEVE }, // 58
+    { "CLEAR", 5, AmcpConnection::CLEAR },                           // 59
+    { 0, 0, AmcpConnection::NONE },                                  // 60
+    { "DATA LIST", 9, AmcpConnection::DATALIST },                    // 61
+    { 0, 0, AmcpConnection::NONE },                                  // 62
+    { 0, 0, AmcpConnection::NONE }                                   // 63
+};
+
+AmcpConnection::AmcpConnection(const QString& address, int port, QObject* parent)
+    : QObject(parent),
+      command(AmcpConnection::NONE), port(port), code(0), state(AmcpConnection::ExpectingHeader), address(address),
+      bufferBegin(0), bufferEnd(0), scanOffset(0), responseTicket(0), responseLatency(0)
+{
+    this->buffer.resize(AmcpConnection::DEFAULT_BUFFER_SIZE);
+    this->lines.reserve(1024);
+    this->clock.start();
+
+    this->socket = new QTcpSocket(this);
+
+    this->probeTimer = new QTimer(this);
+    this->probeTimer->setInterval(AmcpConnection::PROBE_INTERVAL);
+    QObject::connect(this->probeTimer, SIGNAL(timeout()), this, SLOT(sendProbe()));
+
+    QObject::connect(this->socket, SIGNAL(readyRead()), this, SLOT(readMessage()));
+    QObject::connect(this->socket, SIGNAL(connected()), this, SLOT(setConnected()));
+    QObject::connect(this->socket, SIGNAL(disconnected()), this, SLOT(setDisconnected()));
+}
+
+AmcpConnection::~AmcpConnection()
+{
+}
+
+void AmcpConnection::connectToServer()
+{
+    if (this->socket->state() == QAbstractSocket::ConnectedState)
+        return;
+
+    // Drop an attempt that is still pending, it has timed out as far as the caller is concerned.
+    if (this->socket->state() != QAbstractSocket::UnconnectedState)
+        this->socket->abort();
+
+    this->socket->connectToHost(this->address, this->port);
+}
+
+void AmcpConnection::disconnectFromServer()
+{
+    this->probeTimer->stop();
+
+    this->socket->blockSignals(true);
+    this->socket->disconnectFromHost();
+    this->socket->blockSignals(false);
+
+    clearBuffer();
+}
+
+void AmcpConnection::setConnected()
+{
+    clearBuffer();
+
+    this->probeTimer->start();
+
+    emit connectionStateChanged(true);
+}
+
+void AmcpConnection::setDisconnected()
+{
+    this->probeTimer->stop();
+
+    clearBuffer();
+
+    emit connectionStateChanged(false);
+}
+
+void AmcpConnection::writeMessages(const QByteArray& messages, const QList<int>& tickets)
+{
+    if (this->socket->state() != QAbstractSocket::ConnectedState)
+    {
+        // The connection went away while the commands were queued.
+        foreach (int ticket, tickets)
+            emit commandCompleted(ticket, 0, -1);
+
+        return;
+    }
+
+    this->socket->write(messages);
+
+    const qint64 timestamp = this->clock.nsecsElapsed() / 1000;
+    foreach (int ticket, tickets)
+    {
+        AmcpRequest request = { ticket, timestamp };
+        this->requests.enqueue(request);
+    }
+}
+
+void AmcpConnection::sendProbe()
+{
+    // Real commands measure the round trip as well, only probe an idle connection.
+    if (this->socket->state() != QAbstractSocket::ConnectedState || !this->requests.isEmpty())
+        return;
+
+    this->socket->write("VERSION\r\n", 9);
+
+    AmcpRequest request = { AmcpConnection::PROBE_TICKET, this->clock.nsecsElapsed() / 1000 };
+    this->requests.enqueue(request);
+}
+
+int AmcpConnection::getResponseTicket() const
+{
+    return this->responseTicket;
+}
+
+int AmcpConnection::getResponseCount() const
+{
+    return this->lines.count();
+}
+
+QByteArray AmcpConnection::getResponseLine(int index) const
+{
+    // The returned array does not own its data, it is only valid until the current notification returns.
+    const AmcpLine& line = this->lines.at(index);
+    return QByteArray::fromRawData(this->buffer.constData() + line.offset, line.length);
+}
+
+QString AmcpConnection::getResponseString(int index) const
+{
+    const AmcpLine& line = this->lines.at(index);
+    return QString::fromUtf8(this->buffer.constData() + line.offset, line.length);
+}
+
+void AmcpConnection::clearBuffer()
+{
+    this->bufferBegin = 0;
+    this->bufferEnd = 0;
+    this->scanOffset = 0;
+
+    resetResponse();
+    clearRequests();
+}
+
+void AmcpConnection::clearRequests()
+{
+    // The connection is gone, none of the pending commands will be answered.
+    QQueue<AmcpRequest> pending;
+    pending.swap(this->requests);
+
+    while (!pending.isEmpty())
+    {
+        const int ticket = pending.dequeue().ticket;
+        if (ticket == AmcpConnection::PROBE_TICKET)
+            emit probeCompleted(0, -1);
+        else
+            emit commandCompleted(ticket, 0, -1);
+    }
+}
+
+void AmcpConnection::completeResponse()
+{
+    if (this->requests.isEmpty())
+    {
+        this->responseTicket = 0;
+        this->responseLatency = 0;
+    }
+    else
+    {
+        const AmcpRequest request = this->requests.dequeue();
+
+        this->responseTicket = request.ticket;
+        this->responseLatency = this->clock.nsecsElapsed() / 1000 - request.timestamp;
+    }
+
+    const int ticket = this->responseTicket;
+    const int code = this->code;
+    const qint64 latency = this->responseLatency;
+
+    if (ticket == AmcpConnection::PROBE_TICKET)
+    {
+        resetResponse();
+
+        emit probeCompleted(code, latency);
+        return;
+    }
+
+    sendNotification();
+
+    if (ticket > 0)
+        emit commandCompleted(ticket, code, latency);
+}
+
+void AmcpConnection::reserveBuffer(int size)
+{
+    if (this->bufferEnd + size <= this->buffer.size())
+        return;
+
+    // Move the unconsumed bytes to the front of the buffer before we consider growing it.
+    if (this->bufferBegin > 0)
+    {
+        const int shift = this->bufferBegin;
+        ::memmove(this->buffer.data(), this->buffer.constData() + shift, this->bufferEnd - shift);
+
+        for (int i = 0; i < this->lines.count(); i++)
+            this->lines[i].offset -= shift;
+
+        this->bufferBegin = 0;
+        this->bufferEnd -= shift;
+        this->scanOffset -= shift;
+    }
+
+    if (this->bufferEnd + size > this->buffer.size())
+        this->buffer.resize(qMax(this->buffer.size() * 2, this->bufferEnd + size));
+}
+
+void AmcpConnection::readMessage()
+{
+    qint64 available = 0;
+    while ((available = this->socket->bytesAvailable()) > 0)
+    {
+        reserveBuffer(static_cast<int>(available));
+
+        qint64 count = this->socket->read(this->buffer.data() + this->bufferEnd, available);
+        if (count <= 0)
+            break;
+
+        this->bufferEnd += count;
+
+        parseBuffer();
+    }
+}
+
+void AmcpConnection::parseBuffer()
+{
+    const char* data = this->buffer.constData();
+    while (this->scanOffset < this->bufferEnd)
+    {
+        const char* newline = static_cast<const char*>(::memchr(data + this->scanOffset, '\n', this->bufferEnd - this->scanOffset));
+        if (newline == NULL)
+            break; // Wait for the rest of the line.
+
+        const int lineOffset = this->scanOffset;
+        const int lineEnd = newline - data;
+
+        int length = lineEnd - lineOffset;
+        if (length > 0 && data[lineEnd - 1] == '\r')
+            length--;
+
+        this->scanOffset = lineEnd + 1;
+
+        parseLine(lineOffset, length);
+    }
+
+    // Everything up to the current response has been delivered, drop it.
+    if (this->state == AmcpConnection::ExpectingHeader)
+        this->bufferBegin = this->scanOffset;
+
+    if (this->bufferBegin == this->bufferEnd)
+    {
+        this->bufferBegin = 0;
+        this->bufferEnd = 0;
+        this->scanOffset = 0;
+    }
+}
+
+AmcpConnection::AmcpCommand AmcpConnection::translateCommand(const char* data, int length)
+{
+    if (length < 2)
+        return AmcpConnection::NONE;
+
+    const unsigned char* key = reinterpret_cast<const unsigned char*>(data);
+    const AmcpCommandEntry& entry = AmcpConnection::COMMAND_TABLE[(key[0] + key[1] + 6 * key[length - 1]) & (AmcpConnection::COMMAND_TABLE_SIZE - 1)];
+    if (entry.length == length && ::memcmp(entry.name, data, length) == 0)
+        return entry.command;
+
+    return AmcpConnection::NONE;
+}
+
+void AmcpConnection::parseLine(int offset, int length)
+{
+    switch (this->state)
+    {
+        case AmcpConnection::ExpectingHeader:
+            parseHeader(offset, length);
+            break;
+        case AmcpConnection::ExpectingTwoline:
+        {
+            AmcpLine line = { offset, length };
+            this->lines.append(line);
+
+            completeResponse();
+            break;
+        }
+        case AmcpConnection::ExpectingMultiline:
+        {
+            if (length == 0)
+            {
+                completeResponse();
+                break;
+            }
+
+            AmcpLine line = { offset, length };
+            this->lines.append(line);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void AmcpConnection::parseHeader(int offset, int length)
+{
+    if (length == 0)
+        return;
+
+    // A new response starts here, everything in front of it has been delivered.
+    this->bufferBegin = offset;
+
+    const char* data = this->buffer.constData() + offset;
+
+    // Header format: <code> <command> [<subcommand>] <status>, i.e. "200 CLS OK" or "201 INFO SYSTEM OK".
+    int tokenBegin[4] = { 0, 0, 0, 0 };
+    int tokenEnd[4] = { 0, 0, 0, 0 };
+    int tokens = 0;
+    for (int i = 0; i < length && tokens < 4; )
+    {
+        while (i < length && data[i] == ' ')
+            i++;
+
+        if (i == length)
+            break;
+
+        tokenBegin[tokens] = i;
+        while (i < length && data[i] != ' ')
+            i++;
+
+        tokenEnd[tokens++] = i;
+    }
+
+    this->code = 0;
+    for (int i = tokenBegin[0]; i < tokenEnd[0] && data[i] >= '0' && data[i] <= '9'; i++)
+        this->code = this->code * 10 + (data[i] - '0');
+
+    this->command = AmcpConnection::NONE;
+    if (tokens > 3)
+        this->command = translateCommand(data + tokenBegin[1], tokenEnd[2] - tokenBegin[1]);
+    else if (tokens > 1)
+        this->command = translateCommand(data + tokenBegin[1], tokenEnd[1] - tokenBegin[1]);
+
+    AmcpLine line = { offset, length };
+    this->lines.append(line);
+
+    switch (this->code)
+    {
+        case 200: // The command has been executed and several lines of data are being returned.
+            this->state = AmcpConnection::ExpectingMultiline;
+            break;
+        case 201: // The command has been executed and a line of data is being returned.
+        case 400: // Command not understood.
+            this->state = AmcpConnection::ExpectingTwoline;
+            break;
+        default:
+            this->state = AmcpConnection::ExpectingOneline;
+            completeResponse();
+            break;
+    }
+}
+
+void AmcpConnection::resetResponse()
+{
+    this->code = 0;
+    this->responseTicket = 0;
+    this->responseLatency = 0;
+    this->lines.resize(0); // Keep the capacity for the next response.
+    this->command = AmcpConnection::NONE;
+    this->state = AmcpConnection::ExpectingHeader;
+}
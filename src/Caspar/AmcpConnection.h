@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QQueue>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+#include <QtNetwork/QTcpSocket>
+#include <QtNetwork/QAbstractSocket>
+
+// Owns the socket and the reply parser of one AMCP server. Lives in the network thread, see AmcpThread,
+// and only talks to the device on the GUI thread through queued signals and slots.
+class CASPAR_EXPORT AmcpConnection : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit AmcpConnection(const QString& address, int port, QObject* parent = 0);
+        virtual ~AmcpConnection();
+
+        Q_SLOT void connectToServer();
+        Q_SLOT void disconnectFromServer();
+        Q_SLOT void writeMessages(const QByteArray& messages, const QList<int>& tickets);
+
+        Q_SIGNAL void connectionStateChanged(bool connected);
+        Q_SIGNAL void commandCompleted(int ticket, int code, qint64 latency);
+        Q_SIGNAL void probeCompleted(int code, qint64 latency);
+
+    protected:
+        enum AmcpCommand
+        {
+            NONE,
+            LOAD,
+            LOADBG,
+            PLAY,
+            STOP,
+            CG,
+            CLS,
+            CINF,
+            VERSION,
+            TLS,
+            INFO,
+            INFOSYSTEM,
+            DATALIST,
+            DATARETRIEVE,
+            CLEAR,
+            SET,
+            MIXER,
+            CALL,
+            REMOVE,
+            ADD,
+            SWAP,
+            STATUS,
+            ERROR,
+            THUMBNAILLIST,
+            THUMBNAILRETRIEVE
+        };
+
+        AmcpCommand command;
+
+        virtual void sendNotification() = 0;
+
+        void resetResponse();
+
+        int getResponseTicket() const;
+        int getResponseCount() const;
+        QByteArray getResponseLine(int index) const;
+        QString getResponseString(int index) const;
+
+    private:
+        enum AmcpParserState
+        {
+            ExpectingHeader,
+            ExpectingOneline,
+            ExpectingTwoline,
+            ExpectingMultiline
+        };
+
+        struct AmcpLine
+        {
+            int offset;
+            int length;
+        };
+
+        struct AmcpRequest
+        {
+            int ticket;
+            qint64 timestamp;
+        };
+
+        struct AmcpCommandEntry
+        {
+            const char* name;
+            int length;
+            AmcpCommand command;
+        };
+
+        static const int COMMAND_TABLE_SIZE = 64;
+        static const AmcpCommandEntry COMMAND_TABLE[COMMAND_TABLE_SIZE];
+
+        static const int DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        // Keep-alive probes are only sent while nothing else is in flight, they never reach sendNotification().
+        static const int PROBE_TICKET = -1;
+        static const int PROBE_INTERVAL = 10000;
+
+        int port;
+        int code;
+        int state;
+        QString address;
+        QTcpSocket* socket;
+
+        // Receive buffer, reused between responses. Bytes in [bufferBegin, bufferEnd) are unconsumed,
+        // scanOffset is where the search for the next line boundary continues.
+        QByteArray buffer;
+        int bufferBegin;
+        int bufferEnd;
+        int scanOffset;
+        QVector<AmcpLine> lines;
+
+        // Commands written but not yet answered. The server replies in the order commands are received,
+        // so the head of the queue is always the request the next complete response belongs to.
+        int responseTicket;
+        qint64 responseLatency;
+        QElapsedTimer clock;
+        QQueue<AmcpRequest> requests;
+        QTimer* probeTimer;
+
+        void clearBuffer();
+        void clearRequests();
+        void completeResponse();
+        void reserveBuffer(int size);
+        void parseBuffer();
+        void parseLine(int offset, int length);
+        void parseHeader(int offset, int length);
+
+        static AmcpCommand translateCommand(const char* data, int length);
+
+        Q_SLOT void readMessage();
+        Q_SLOT void sendProbe();
+        Q_SLOT void setConnected();
+        Q_SLOT void setDisconnected();
+};
@@ -1,22 +1,53 @@
 #include "AmcpDevice.h"
+#include "AmcpThread.h"
 
-#include <QtCore/QStringList>
-#include <QtCore/QThread>
-#include <QtCore/QTimer>
+#include <string.h>
 
-AmcpDevice::AmcpDevice(const QString& address, int port, QObject* parent)
+#include <QtCore/QMetaType>
+
+// MIXER properties where a later command fully replaces an earlier one to the same channel and layer.
+// Only the transforms are held back by DEFER until the next MIXER COMMIT, the rest apply immediately.
+const AmcpDevice::AmcpMixerProperty AmcpDevice::MIXER_PROPERTIES[] =
+{
+    { "BLEND", 5, false },
+    { "BRIGHTNESS", 10, true },
+    { "CHROMA", 6, false },
+    { "CLIP", 4, true },
+    { "CONTRAST", 8, true },
+    { "FILL", 4, true },
+    { "KEYER", 5, true },
+    { "LEVELS", 6, true },
+    { "MASTERVOLUME", 12, false },
+    { "OPACITY", 7, true },
+    { "SATURATION", 10, true },
+    { "VOLUME", 6, true },
+    { 0, 0, false }
+};
+
+AmcpDevice::AmcpDevice(const QString& address, int port, AmcpConnection* connection, QObject* parent)
     : QObject(parent),
-      command(AmcpDevice::NONE), port(port), state(AmcpDevice::ExpectingHeader), connected(false), address(address), disableCommands(false)
+      command(AmcpDevice::NONE), connection(connection), port(port), connected(false), address(address), disableCommands(false),
+      nextTicket(1), pendingCount(0), flushScheduled(false), latencyFailures(0), probes(0), lastProbe(0), deferDepth(0)
 {
-    this->socket = new QTcpSocket(this);
+    qRegisterMetaType<qint64>("qint64");
+    qRegisterMetaType<QList<int> >("QList<int>");
+
+    this->messages.reserve(64);
+
+    AmcpWriteStatistics statistics = { 0, 0, 0, 0, 0, 0 };
+    this->statistics = statistics;
+
+    this->connection->moveToThread(&AmcpThread::getInstance());
 
-    QObject::connect(this->socket, SIGNAL(readyRead()), this, SLOT(readMessage()));
-    QObject::connect(this->socket, SIGNAL(connected()), this, SLOT(setConnected()));
-    QObject::connect(this->socket, SIGNAL(disconnected()), this, SLOT(setDisconnected()));
+    QObject::connect(this->connection, SIGNAL(connectionStateChanged(bool)), this, SLOT(setConnectionState(bool)));
+    QObject::connect(this->connection, SIGNAL(commandCompleted(int, int, qint64)), this, SLOT(setCommandCompleted(int, int, qint64)));
+    QObject::connect(this->connection, SIGNAL(probeCompleted(int, qint64)), this, SLOT(setProbeCompleted(int, qint64)));
 }
 
 AmcpDevice::~AmcpDevice()
 {
+    // The connection lives in the network thread, let it delete itself (and its socket) there.
+    this->connection->deleteLater();
 }
 
 void AmcpDevice::connectDevice()
@@ -24,16 +55,15 @@ void AmcpDevice::connectDevice()
     if (this->connected)
         return;
 
-    this->socket->connectToHost(this->address, this->port);
-
-    QTimer::singleShot(5000, this, SLOT(connectDevice()));
+    // A single attempt, retries are up to the owner (see ReconnectScheduler in Core).
+    QMetaObject::invokeMethod(this->connection, "connectToServer", Qt::QueuedConnection);
 }
 
 void AmcpDevice::disconnectDevice()
 {
-    this->socket->blockSignals(true);
-    this->socket->disconnectFromHost();
-    this->socket->blockSignals(false);
+    clearMessages();
+
+    QMetaObject::invokeMethod(this->connection, "disconnectFromServer", Qt::QueuedConnection);
 
     this->connected = false;
     this->command = AmcpDevice::CONNECTIONSTATE;
@@ -41,22 +71,52 @@ void AmcpDevice::disconnectDevice()
     sendNotification();
 }
 
-void AmcpDevice::setConnected()
+void AmcpDevice::setConnectionState(bool connected)
 {
-    this->connected = true;
+    clearMessages();
+
+    this->connected = connected;
     this->command = AmcpDevice::CONNECTIONSTATE;
 
     sendNotification();
 }
 
-void AmcpDevice::setDisconnected()
+void AmcpDevice::setCommandCompleted(int ticket, int code, qint64 latency)
 {
-    this->connected = false;
-    this->command = AmcpDevice::CONNECTIONSTATE;
+    if (latency < 0)
+        this->latencyFailures++;
+    else
+        this->latency.add(latency);
 
-    sendNotification();
+    completeCommand(ticket, code, latency);
+}
+
+void AmcpDevice::setProbeCompleted(int code, qint64 latency)
+{
+    Q_UNUSED(code);
+
+    this->probes++;
+    this->lastProbe = latency;
 
-    QTimer::singleShot(5000, this, SLOT(connectAmcpDevice()));
+    if (latency < 0)
+        this->latencyFailures++;
+    else
+        this->latency.add(latency);
+}
+
+void AmcpDevice::completeCommand(int ticket, int code, qint64 latency)
+{
+    if (this->pendingCount > 0)
+        this->pendingCount--;
+
+    emit commandCompleted(ticket, code, latency);
+
+    // Commands replaced by this one before they were sent share its reply.
+    if (this->supersededTickets.contains(ticket))
+    {
+        foreach (int superseded, this->supersededTickets.take(ticket))
+            completeCommand(superseded, code, latency);
+    }
 }
 
 void AmcpDevice::setDisableCommands(bool disable)
@@ -79,142 +139,221 @@ const QString &AmcpDevice::getAddress() const
     return this->address;
 }
 
-void AmcpDevice::writeMessage(const QString& message)
+int AmcpDevice::getPendingCount() const
+{
+    return this->pendingCount;
+}
+
+const AmcpDevice::AmcpWriteStatistics& AmcpDevice::getWriteStatistics() const
 {
-    if (this->connected && !this->disableCommands)
-        this->socket->write(QString("%1\r\n").arg(message.trimmed()).toUtf8());
+    return this->statistics;
 }
 
-void AmcpDevice::readMessage()
+const AmcpDevice::AmcpLatencyStatistics AmcpDevice::getLatencyStatistics() const
 {
-    while (this->socket->bytesAvailable() && this->socket->canReadLine())
+    AmcpLatencyStatistics statistics = { this->latency.getCount(), this->latencyFailures, this->probes, this->lastProbe,
+                                         this->latency.getPercentile(50), this->latency.getPercentile(99), this->latency.getMaximum() };
+
+    return statistics;
+}
+
+void AmcpDevice::resetLatencyStatistics()
+{
+    this->latency.clear();
+    this->latencyFailures = 0;
+    this->probes = 0;
+    this->lastProbe = 0;
+}
+
+AmcpEncoder& AmcpDevice::beginMessage()
+{
+    return this->encoder.begin();
+}
+
+int AmcpDevice::writeMessage(const AmcpEncoder& encoder)
+{
+    Q_ASSERT(&encoder == &this->encoder);
+
+    const int offset = this->encoder.getBegin();
+    if (!this->connected || this->disableCommands)
+    {
+        this->encoder.truncate(offset);
+        return 0;
+    }
+
+    const int ticket = this->nextTicket++;
+    if (this->nextTicket <= 0)
+        this->nextTicket = 1;
+
+    this->pendingCount++;
+
+    AmcpMessage entry = { offset, this->encoder.getLength() - offset, ticket, false };
+
+    int propertyEnd = 0;
+    const AmcpMixerProperty* property = findMixerProperty(this->encoder.getData() + offset, entry.length, propertyEnd);
+    if (property == NULL)
+    {
+        // Anything else may depend on the commands in front of it, never move commands across it.
+        this->coalesceIndex.clear();
+    }
+    else
     {
-        this->line += QString::fromUtf8(this->socket->readLine());
-        if (this->line.endsWith("\r\n"))
+        bool defer = entry.length > 6 && ::memcmp(this->encoder.getData() + offset + entry.length - 6, " DEFER", 6) == 0;
+        if (!defer && property->deferrable && this->deferDepth > 0)
+        {
+            this->encoder.token(AmcpEncoder::DEFER);
+            entry.length = this->encoder.getLength() - offset;
+            defer = true;
+
+            int channel = 0;
+            for (const char* data = this->encoder.getData() + offset + 6; *data >= '0' && *data <= '9'; data++)
+                channel = channel * 10 + (*data - '0');
+
+            if (!this->deferredChannels.contains(channel))
+                this->deferredChannels.append(channel);
+        }
+
+        // Deferred and immediate values are applied at different times, keep one of each.
+        QByteArray key(this->encoder.getData() + offset, propertyEnd);
+        if (defer)
+            key.append(" DEFER");
+
+        QHash<QByteArray, int>::iterator position = this->coalesceIndex.find(key);
+        if (position != this->coalesceIndex.end())
         {
-            if (this->line == "\r\n")
-                this->line.remove("\r\n");
+            AmcpMessage& previous = this->messages[position.value()];
+            previous.superseded = true;
 
-            QStringList lines = this->line.split("\r\n");
-            foreach (QString line, lines)
-                parseLine(line);
+            QList<int>& tickets = this->supersededTickets[ticket];
+            tickets.append(previous.ticket);
+            tickets.append(this->supersededTickets.take(previous.ticket));
 
-            this->line.clear();
+            this->statistics.coalesced++;
         }
+
+        this->coalesceIndex.insert(key, this->messages.count());
     }
-}
 
-AmcpDevice::AmcpDeviceCommand AmcpDevice::translateCommand(const QString& command)
-{
-    if (command == "LOAD") return AmcpDevice::LOAD;
-    else if (command == "LOADBG") return AmcpDevice::LOADBG;
-    else if (command == "PLAY") return AmcpDevice::PLAY;
-    else if (command == "STOP") return AmcpDevice::STOP;
-    else if (command == "CG") return AmcpDevice::CG;
-    else if (command == "CLS") return AmcpDevice::CLS;
-    else if (command == "CINF") return AmcpDevice::CINF;
-    else if (command == "VERSION") return AmcpDevice::VERSION;
-    else if (command == "TLS") return AmcpDevice::TLS;
-    else if (command == "INFO") return AmcpDevice::INFO;
-    else if (command == "INFO SYSTEM") return AmcpDevice::INFOSYSTEM;
-    else if (command == "DATA LIST") return AmcpDevice::DATALIST;
-    else if (command == "DATA RETRIEVE") return AmcpDevice::DATARETRIEVE;
-    else if (command == "CLEAR") return AmcpDevice::CLEAR;
-    else if (command == "SET") return AmcpDevice::SET;
-    else if (command == "MIXER") return AmcpDevice::MIXER;
-    else if (command == "CALL") return AmcpDevice::CALL;
-    else if (command == "REMOVE") return AmcpDevice::REMOVE;
-    else if (command == "ADD") return AmcpDevice::ADD;
-    else if (command == "SWAP") return AmcpDevice::SWAP;
-    else if (command == "STATUS") return AmcpDevice::STATUS;
-    else if (command == "ERROR") return AmcpDevice::ERROR;
-    else if (command == "THUMBNAIL LIST") return AmcpDevice::THUMBNAILLIST;
-    else if (command == "THUMBNAIL RETRIEVE") return AmcpDevice::THUMBNAILRETRIEVE;
-
-    return AmcpDevice::NONE;
-}
-
-void AmcpDevice::parseLine(const QString& line)
-{
-    switch (this->state)
+    this->messages.append(entry);
+
+    if (!this->flushScheduled)
     {
-        case AmcpDevice::ExpectingHeader:
-            parseHeader(line);
-            break;
-        case AmcpDevice::ExpectingOneline:
-            parseOneline(line);
-            this->previousLine = line;
-            break;
-        case AmcpDevice::ExpectingTwoline:
-            parseTwoline(line);
-            this->previousLine = line;
-            break;
-        case AmcpDevice::ExpectingMultiline:
-            parseMultiline(line);
-            this->previousLine = line;
-            break;
-        default:
-            break;
+        this->flushScheduled = true;
+        QMetaObject::invokeMethod(this, "flushMessages", Qt::QueuedConnection);
     }
+
+    return ticket;
 }
 
-void AmcpDevice::parseHeader(const QString& line)
+void AmcpDevice::flushMessages()
 {
-    if (line.length() == 0)
+    this->flushScheduled = false;
+
+    if (this->messages.isEmpty())
         return;
 
-    QStringList tokens = line.split(" ");
+    QList<int> tickets;
+    tickets.reserve(this->messages.count());
 
-    this->code = tokens.at(0).toInt();
-    switch (this->code)
+    int size = 0;
+    for (int i = 0; i < this->messages.count(); i++)
     {
-        case 200: // The command has been executed and several lines of data are being returned.
-            this->state = AmcpDevice::ExpectingMultiline;
-            break;
-        case 201: // The command has been executed and a line of data is being returned.
-        case 400: // Command not understood.
-            this->state = AmcpDevice::ExpectingTwoline;
-            break;
-        default:
-            this->state = AmcpDevice::ExpectingOneline;
-            break;
+        if (!this->messages.at(i).superseded)
+            size += this->messages.at(i).length + 2;
     }
 
-    this->command = translateCommand(tokens.at(1));
-    if (tokens.count() > 3)
-        this->command = translateCommand(QString("%1 %2").arg(tokens.at(1)).arg(tokens.at(2)));
+    // One allocation for the whole block, the superseded commands are left out.
+    QByteArray block;
+    block.resize(size);
+
+    char* out = block.data();
+    for (int i = 0; i < this->messages.count(); i++)
+    {
+        const AmcpMessage& entry = this->messages.at(i);
+        if (entry.superseded)
+            continue;
 
-    this->response.append(line);
+        ::memcpy(out, this->encoder.getData() + entry.offset, entry.length);
+        out += entry.length;
+        *out++ = '\r';
+        *out++ = '\n';
+
+        tickets.append(entry.ticket);
+    }
+
+    QMetaObject::invokeMethod(this->connection, "writeMessages", Qt::QueuedConnection,
+                              Q_ARG(QByteArray, block), Q_ARG(QList<int>, tickets));
+
+    this->statistics.flushes++;
+    this->statistics.commands += tickets.count();
+    this->statistics.bytes += size;
+    this->statistics.lastCommands = tickets.count();
+    this->statistics.lastBytes = size;
+
+    this->messages.resize(0); // Keep the capacity for the next iteration.
+    this->coalesceIndex.clear();
+    this->encoder.clear();
 }
 
-void AmcpDevice::parseOneline(const QString& line)
+void AmcpDevice::clearMessages()
 {
-    if (line.length() > 0)
-         AmcpDevice::response.append(line);
-    else if (line.length() == 0 && AmcpDevice::response.count() > 0)
-        sendNotification();
+    // Nothing queued will reach the server, fail the tickets the same way the connection does.
+    QVector<AmcpMessage> messages;
+    qSwap(messages, this->messages);
+    this->messages.reserve(64);
+
+    this->coalesceIndex.clear();
+    this->encoder.clear();
+
+    foreach (const AmcpMessage& entry, messages)
+    {
+        if (!entry.superseded)
+            completeCommand(entry.ticket, 0, -1);
+    }
 }
 
-void AmcpDevice::parseTwoline(const QString& line)
+const AmcpDevice::AmcpMixerProperty* AmcpDevice::findMixerProperty(const char* data, int length, int& propertyEnd)
 {
-    if (line.length() > 0)
-         AmcpDevice::response.append(line);
-    else if (line.length() == 0 && AmcpDevice::response.count() > 1)
-        sendNotification();
+    // Format: MIXER <channel>[-<layer>] <property> <values> [DEFER]
+    if (length < 6 || ::memcmp(data, "MIXER ", 6) != 0)
+        return NULL;
+
+    const char* layerEnd = static_cast<const char*>(::memchr(data + 6, ' ', length - 6));
+    if (layerEnd == NULL)
+        return NULL;
+
+    const int propertyBegin = layerEnd - data + 1;
+    const char* end = static_cast<const char*>(::memchr(data + propertyBegin, ' ', length - propertyBegin));
+    propertyEnd = (end == NULL) ? length : end - data;
+
+    for (int i = 0; AmcpDevice::MIXER_PROPERTIES[i].name != 0; i++)
+    {
+        const AmcpMixerProperty& property = AmcpDevice::MIXER_PROPERTIES[i];
+        if (property.length == propertyEnd - propertyBegin && ::memcmp(property.name, data + propertyBegin, property.length) == 0)
+            return &property;
+    }
+
+    return NULL;
 }
 
-void AmcpDevice::parseMultiline(const QString& line)
+void AmcpDevice::beginDeferredMixer()
 {
-    if (line.length() > 0)
-        AmcpDevice::response.append(line);
-    else if (line.length() == 0 && this->line.length() == 0 && this->previousLine.length() == 0)
-        sendNotification();
+    this->deferDepth++;
+}
+
+void AmcpDevice::commitDeferredMixer()
+{
+    if (this->deferDepth == 0 || --this->deferDepth > 0)
+        return;
+
+    QList<int> channels;
+    channels.swap(this->deferredChannels);
+
+    foreach (int channel, channels)
+        writeMessage(beginMessage().token(AmcpEncoder::MIXER).integer(channel).token(AmcpEncoder::COMMIT));
 }
 
 void AmcpDevice::resetDevice()
 {
-    this->code = 0;
-    this->response.clear();
     this->command = AmcpDevice::NONE;
-    this->state = AmcpDevice::ExpectingHeader;
 }
@@ -0,0 +1,363 @@
+#include "AmcpEncoder.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <QtCore/qnumeric.h>
+
+// Indexed by AmcpToken, keep both in the same order.
+const AmcpEncoder::AmcpTokenEntry AmcpEncoder::TOKEN_TABLE[] =
+{
+    { "LOAD", 4 },
+    { "LOADBG", 6 },
+    { "PLAY", 4 },
+    { "PAUSE", 5 },
+    { "STOP", 4 },
+    { "CLEAR", 5 },
+    { "CG", 2 },
+    { "MIXER", 5 },
+    { "ADD", 3 },
+    { "REMOVE", 6 },
+    { "CLS", 3 },
+    { "TLS", 3 },
+    { "INFO", 4 },
+    { "VERSION", 7 },
+    { "DATA", 4 },
+    { "THUMBNAIL", 9 },
+    { "LIST", 4 },
+    { "RETRIEVE", 8 },
+    { "FLASH", 5 },
+    { "SERVER", 6 },
+    { "TEMPLATEHOST", 12 },
+    { "INVOKE", 6 },
+    { "NEXT", 4 },
+    { "UPDATE", 6 },
+    { "COMMIT", 6 },
+    { "MASTERVOLUME", 12 },
+    { "CHROMA", 6 },
+    { "BLEND", 5 },
+    { "GRID", 4 },
+    { "KEYER", 5 },
+    { "VOLUME", 6 },
+    { "OPACITY", 7 },
+    { "BRIGHTNESS", 10 },
+    { "CONTRAST", 8 },
+    { "SATURATION", 10 },
+    { "LEVELS", 6 },
+    { "FILL", 4 },
+    { "CLIP", 4 },
+    { "DEFER", 5 },
+    { "LOOP", 4 },
+    { "AUTO", 4 },
+    { "SEEK", 4 },
+    { "LENGTH", 6 },
+    { "BLUR", 4 },
+    { "SPEED", 5 },
+    { "PREMULTIPLY", 11 },
+    { "PROGRESSIVE", 11 },
+    { "DECKLINK", 8 },
+    { "DEVICE", 6 },
+    { "FORMAT", 6 },
+    { "FILE", 4 },
+    { "IMAGE", 5 },
+    { "SEPARATE_KEY", 12 },
+    { "-vcodec", 7 },
+    { "-preset", 7 },
+    { "-tune", 5 },
+};
+
+static const double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10 };
+
+static qint64 roundHalfEven(double value)
+{
+    const double integral = floor(value);
+    const double fraction = value - integral;
+
+    qint64 result = static_cast<qint64>(integral);
+    if (fraction > 0.5 || (fraction == 0.5 && (result & 1) != 0))
+        result++;
+
+    return result;
+}
+
+AmcpEncoder::AmcpEncoder(int capacity)
+    : length(0), commandBegin(0)
+{
+    this->buffer.resize(capacity);
+}
+
+AmcpEncoder& AmcpEncoder::begin()
+{
+    this->commandBegin = this->length;
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::token(AmcpToken token)
+{
+    const AmcpTokenEntry& entry = AmcpEncoder::TOKEN_TABLE[token];
+
+    return raw(entry.name, entry.length);
+}
+
+AmcpEncoder& AmcpEncoder::integer(int value)
+{
+    separate();
+    writeInteger(value);
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::real(float value)
+{
+    // Same output as QString::arg(double), %g with six significant digits, but independent of the locale.
+    const double number = value;
+    const double magnitude = qAbs(number);
+    if (qIsNaN(number) || qIsInf(number) || (magnitude != 0 && (magnitude < 1e-4 || magnitude >= 1e6)))
+    {
+        const QByteArray formatted = QByteArray::number(number, 'g', 6);
+        return raw(formatted.constData(), formatted.length());
+    }
+
+    int decimals = (magnitude == 0) ? 0 : qBound(0, 5 - static_cast<int>(floor(log10(magnitude))), 10);
+    qint64 digits = roundHalfEven(magnitude * POWERS_OF_TEN[decimals]);
+    if (digits >= 1000000 && decimals > 0)
+        digits = roundHalfEven(magnitude * POWERS_OF_TEN[--decimals]);
+
+    if (digits >= 1000000)
+    {
+        // Rounded up to the next power of ten, %g switches to the exponent form here.
+        const QByteArray formatted = QByteArray::number(number, 'g', 6);
+        return raw(formatted.constData(), formatted.length());
+    }
+
+    while (decimals > 0 && digits % 10 == 0)
+    {
+        digits /= 10;
+        decimals--;
+    }
+
+    // Least significant digit first.
+    char text[24];
+    int count = 0;
+    do
+    {
+        text[count++] = static_cast<char>('0' + digits % 10);
+        digits /= 10;
+    } while (digits > 0);
+
+    separate();
+    reserve(count + decimals + 3);
+
+    char* out = this->buffer.data() + this->length;
+    if (number < 0 && (count > 1 || text[0] != '0'))
+        *out++ = '-';
+
+    if (count <= decimals)
+        *out++ = '0';
+    else
+        for (int i = count - 1; i >= decimals; i--)
+            *out++ = text[i];
+
+    if (decimals > 0)
+    {
+        *out++ = '.';
+        for (int i = decimals - 1; i >= 0; i--)
+            *out++ = (i < count) ? text[i] : '0';
+    }
+
+    this->length = out - this->buffer.constData();
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::layer(int channel, int videolayer)
+{
+    separate();
+    writeInteger(channel);
+
+    reserve(1);
+    this->buffer.data()[this->length++] = '-';
+
+    writeInteger(videolayer);
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::quoted(const QString& value)
+{
+    separate();
+    reserve(1);
+    this->buffer.data()[this->length++] = '"';
+
+    writeUtf8(value);
+
+    reserve(1);
+    this->buffer.data()[this->length++] = '"';
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::text(const QString& value)
+{
+    if (value.isEmpty())
+        return *this;
+
+    separate();
+    writeUtf8(value);
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::raw(const char* data, int length)
+{
+    if (length == 0)
+        return *this;
+
+    separate();
+    reserve(length);
+
+    ::memcpy(this->buffer.data() + this->length, data, length);
+    this->length += length;
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::easing(int duration, const QString& easing)
+{
+    return integer(duration).text(easing);
+}
+
+AmcpEncoder& AmcpEncoder::option(bool enabled, AmcpToken token)
+{
+    if (enabled)
+        this->token(token);
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::option(bool enabled, AmcpToken token, int value)
+{
+    if (enabled)
+        this->token(token).integer(value);
+
+    return *this;
+}
+
+AmcpEncoder& AmcpEncoder::option(bool enabled, AmcpToken token, const QString& value)
+{
+    if (enabled && !value.isEmpty())
+        this->token(token).text(value);
+
+    return *this;
+}
+
+void AmcpEncoder::clear()
+{
+    this->length = 0;
+    this->commandBegin = 0;
+}
+
+void AmcpEncoder::truncate(int length)
+{
+    this->length = qMin(this->length, length);
+    this->commandBegin = qMin(this->commandBegin, this->length);
+}
+
+int AmcpEncoder::getBegin() const
+{
+    return this->commandBegin;
+}
+
+int AmcpEncoder::getLength() const
+{
+    return this->length;
+}
+
+const char* AmcpEncoder::getData() const
+{
+    return this->buffer.constData();
+}
+
+void AmcpEncoder::separate()
+{
+    if (this->length == this->commandBegin)
+        return;
+
+    reserve(1);
+    this->buffer.data()[this->length++] = ' ';
+}
+
+void AmcpEncoder::reserve(int size)
+{
+    if (this->length + size > this->buffer.size())
+        this->buffer.resize(qMax(this->buffer.size() * 2, this->length + size));
+}
+
+void AmcpEncoder::writeInteger(int value)
+{
+    reserve(12);
+
+    // Least significant digit first.
+    char digits[12];
+    int count = 0;
+
+    unsigned int magnitude = (value < 0) ? 0u - static_cast<unsigned int>(value) : static_cast<unsigned int>(value);
+    do
+    {
+        digits[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    char* out = this->buffer.data() + this->length;
+    if (value < 0)
+        *out++ = '-';
+
+    while (count > 0)
+        *out++ = digits[--count];
+
+    this->length = out - this->buffer.constData();
+}
+
+void AmcpEncoder::writeUtf8(const QString& value)
+{
+    // Worst case is three bytes per UTF-16 code unit.
+    reserve(value.length() * 3);
+
+    char* out = this->buffer.data() + this->length;
+
+    const ushort* data = value.utf16();
+    const int length = value.length();
+    for (int i = 0; i < length; i++)
+    {
+        uint code = data[i];
+        if (code < 0x80)
+        {
+            *out++ = static_cast<char>(code);
+        }
+        else if (code < 0x800)
+        {
+            *out++ = static_cast<char>(0xc0 | (code >> 6));
+            *out++ = static_cast<char>(0x80 | (code & 0x3f));
+        }
+        else
+        {
+            if (QChar::isHighSurrogate(code) && i + 1 < length && QChar::isLowSurrogate(data[i + 1]))
+            {
+                code = QChar::surrogateToUcs4(code, data[++i]);
+
+                *out++ = static_cast<char>(0xf0 | (code >> 18));
+                *out++ = static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+            }
+            else
+            {
+                *out++ = static_cast<char>(0xe0 | (code >> 12));
+            }
+
+            *out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+            *out++ = static_cast<char>(0x80 | (code & 0x3f));
+        }
+    }
+
+    this->length = out - this->buffer.constData();
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+// Writes AMCP commands straight into a growable byte buffer, one token at a time. Tokens are
+// separated by single spaces, empty text is skipped and strings are encoded as UTF-8 in place.
+class CASPAR_EXPORT AmcpEncoder
+{
+    public:
+        enum AmcpToken
+        {
+            LOAD,
+            LOADBG,
+            PLAY,
+            PAUSE,
+            STOP,
+            CLEAR,
+            CG,
+            MIXER,
+            ADD,
+            REMOVE,
+            CLS,
+            TLS,
+            INFO,
+            VERSION,
+            DATA,
+            THUMBNAIL,
+            LIST,
+            RETRIEVE,
+            FLASH,
+            SERVER,
+            TEMPLATEHOST,
+            INVOKE,
+            NEXT,
+            UPDATE,
+            COMMIT,
+            MASTERVOLUME,
+            CHROMA,
+            BLEND,
+            GRID,
+            KEYER,
+            VOLUME,
+            OPACITY,
+            BRIGHTNESS,
+            CONTRAST,
+            SATURATION,
+            LEVELS,
+            FILL,
+            CLIP,
+            DEFER,
+            LOOP,
+            AUTO,
+            SEEK,
+            LENGTH,
+            BLUR,
+            SPEED,
+            PREMULTIPLY,
+            PROGRESSIVE,
+            DECKLINK,
+            DEVICE,
+            FORMAT,
+            FILE,
+            IMAGE,
+            SEPARATE_KEY,
+            VCODEC,
+            PRESET,
+            TUNE
+        };
+
+        explicit AmcpEncoder(int capacity = 16 * 1024);
+
+        AmcpEncoder& begin();
+        AmcpEncoder& token(AmcpToken token);
+        AmcpEncoder& integer(int value);
+        AmcpEncoder& real(float value);
+        AmcpEncoder& layer(int channel, int videolayer);
+        AmcpEncoder& quoted(const QString& value);
+        AmcpEncoder& text(const QString& value);
+        AmcpEncoder& raw(const char* data, int length);
+        AmcpEncoder& easing(int duration, const QString& easing);
+        AmcpEncoder& option(bool enabled, AmcpToken token);
+        AmcpEncoder& option(bool enabled, AmcpToken token, int value);
+        AmcpEncoder& option(bool enabled, AmcpToken token, const QString& value);
+
+        void clear();
+        void truncate(int length);
+
+        int getBegin() const;
+        int getLength() const;
+        const char* getData() const;
+
+    private:
+        struct AmcpTokenEntry
+        {
+            const char* name;
+            int length;
+        };
+
+        static const AmcpTokenEntry TOKEN_TABLE[];
+
+        QByteArray buffer;
+        int length;
+        int commandBegin;
+
+        void separate();
+        void reserve(int size);
+        void writeInteger(int value);
+        void writeUtf8(const QString& value);
+};
@@ -0,0 +1,81 @@
+#include "AmcpLatencyHistogram.h"
+
+#include <string.h>
+
+AmcpLatencyHistogram::AmcpLatencyHistogram()
+{
+    clear();
+}
+
+void AmcpLatencyHistogram::add(qint64 latency)
+{
+    if (latency < 0)
+        return;
+
+    this->buckets[bucketOf(latency)]++;
+    this->maximum = qMax(this->maximum, latency);
+    this->count++;
+}
+
+void AmcpLatencyHistogram::clear()
+{
+    this->count = 0;
+    this->maximum = 0;
+    ::memset(this->buckets, 0, sizeof(this->buckets));
+}
+
+int AmcpLatencyHistogram::getCount() const
+{
+    return this->count;
+}
+
+qint64 AmcpLatencyHistogram::getMaximum() const
+{
+    return this->maximum;
+}
+
+qint64 AmcpLatencyHistogram::getPercentile(int percentile) const
+{
+    if (this->count == 0)
+        return 0;
+
+    // Rank of the sample we are looking for, rounded up so p99 of a few samples is the slowest one.
+    const qint64 rank = qMax(static_cast<qint64>(1), (static_cast<qint64>(this->count) * percentile + 99) / 100);
+
+    qint64 seen = 0;
+    for (int i = 0; i < AmcpLatencyHistogram::BUCKET_COUNT; i++)
+    {
+        seen += this->buckets[i];
+        if (seen >= rank)
+            return (i == AmcpLatencyHistogram::BUCKET_COUNT - 1) ? this->maximum : qMin(upperBoundOf(i), this->maximum);
+    }
+
+    return this->maximum;
+}
+
+int AmcpLatencyHistogram::bucketOf(qint64 latency)
+{
+    if (latency < 4)
+        return static_cast<int>(latency);
+
+    // Shift down to [4, 8), the number of shifts is the octave and what is left picks one of four buckets in it.
+    int octave = 0;
+    while (latency >= 8)
+    {
+        latency >>= 1;
+        octave++;
+    }
+
+    return qMin(4 + octave * 4 + static_cast<int>(latency - 4), AmcpLatencyHistogram::BUCKET_COUNT - 1);
+}
+
+qint64 AmcpLatencyHistogram::upperBoundOf(int bucket)
+{
+    if (bucket < 4)
+        return bucket;
+
+    const int octave = (bucket - 4) / 4;
+    const int step = (bucket - 4) % 4;
+
+    return (static_cast<qint64>(5 + step) << octave) - 1;
+}
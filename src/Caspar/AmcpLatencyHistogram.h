@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QtGlobal>
+
+// Round trip times in microseconds. Buckets are four per power of two, so percentiles are accurate
+// to within 25% from a few microseconds up to about a minute at a fixed, small memory cost.
+class CASPAR_EXPORT AmcpLatencyHistogram
+{
+    public:
+        explicit AmcpLatencyHistogram();
+
+        void add(qint64 latency);
+        void clear();
+
+        int getCount() const;
+        qint64 getMaximum() const;
+        qint64 getPercentile(int percentile) const;
+
+    private:
+        static const int BUCKET_COUNT = 100;
+
+        int count;
+        qint64 maximum;
+        int buckets[BUCKET_COUNT];
+
+        static int bucketOf(qint64 latency);
+        static qint64 upperBoundOf(int bucket);
+};
@@ -0,0 +1,21 @@
+#include "AmcpThread.h"
+
+Q_GLOBAL_STATIC(AmcpThread, amcpThread)
+
+AmcpThread::AmcpThread(QObject* parent)
+    : QThread(parent)
+{
+    QThread::setObjectName("AmcpThread");
+    QThread::start();
+}
+
+AmcpThread::~AmcpThread()
+{
+    QThread::quit();
+    QThread::wait();
+}
+
+AmcpThread& AmcpThread::getInstance()
+{
+    return *amcpThread();
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+
+// Network thread shared by all AMCP connections, keeps socket reads and reply parsing off the GUI thread.
+class CASPAR_EXPORT AmcpThread : public QThread
+{
+    Q_OBJECT
+
+    public:
+        explicit AmcpThread(QObject* parent = 0);
+        virtual ~AmcpThread();
+
+        static AmcpThread& getInstance();
+};
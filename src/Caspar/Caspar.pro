@@ -18,7 +18,13 @@ HEADERS += \
     Models/CasparTemplate.h \
     Models/CasparMedia.h \
     Models/CasparData.h \
-    AmcpDevice.h
+    AmcpDevice.h \
+    AmcpConnection.h \
+    AmcpThread.h \
+    AmcpEncoder.h \
+    AmcpLatencyHistogram.h \
+    CasparConnection.h \
+    HostResolver.h
 	
 SOURCES += \
     CasparDevice.cpp \
@@ -26,4 +32,10 @@ SOURCES += \
     Models/CasparTemplate.cpp \
     Models/CasparMedia.cpp \
     Models/CasparData.cpp \
-    AmcpDevic.cpp
+    AmcpDevic.cpp \
+    AmcpConnection.cpp \
+    AmcpThread.cpp \
+    AmcpEncoder.cpp \
+    AmcpLatencyHistogram.cpp \
+    CasparConnection.cpp \
+    HostResolver.cpp
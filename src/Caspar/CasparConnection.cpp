@@ -0,0 +1,227 @@
+#include "CasparConnection.h"
+
+#include <QtCore/QStringList>
+
+CasparConnection::CasparConnection(const QString& address, int port, QObject* parent)
+    : AmcpConnection(address, port, parent)
+{
+}
+
+QString CasparConnection::convertToTimecode(double time, int fps)
+{
+    QString smpteFormat;
+
+    int hour = (int)(time / 3600);
+    int minutes = (int)((time - hour * 3600) / 60);
+    int seconds = (int)(time - hour * 3600 - minutes * 60);
+    int frames = (int)((time - hour * 3600 - minutes * 60 - seconds) * fps);
+
+    return smpteFormat.sprintf("%02d:%02d:%02d:%02d", hour, minutes, seconds, frames);
+}
+
+int CasparConnection::parseInt(const char* data, int length)
+{
+    int value = 0;
+    for (int i = 0; i < length && data[i] >= '0' && data[i] <= '9'; i++)
+        value = value * 10 + (data[i] - '0');
+
+    return value;
+}
+
+int CasparConnection::parseListItem(const QByteArray& line, QString& name, QByteArray* fields, int maxFields)
+{
+    // Format:
+    // "AMB"  MOVIE  6445960 20121101160514 643 1/60
+    // "CG1080I50"  MOVIE  6159792 20121101150514 264 1/25
+    const char* data = line.constData();
+    const int length = line.length();
+
+    int nameBegin = 0;
+    int nameEnd = length;
+    int position = length;
+    for (int i = 0; i + 1 < length; i++)
+    {
+        if (data[i] == '"' && data[i + 1] == ' ' && i > 0)
+        {
+            nameEnd = i;
+            position = i + 2;
+            break;
+        }
+    }
+
+    if (nameBegin < nameEnd && data[nameBegin] == '"')
+        nameBegin++;
+
+    if (nameEnd > nameBegin && data[nameEnd - 1] == '"')
+        nameEnd--;
+
+    name = QString::fromUtf8(data + nameBegin, nameEnd - nameBegin);
+    name.replace('\\', '/');
+
+    int count = 0;
+    while (position < length && count < maxFields)
+    {
+        while (position < length && data[position] == ' ')
+            position++;
+
+        if (position == length)
+            break;
+
+        const int fieldBegin = position;
+        while (position < length && data[position] != ' ')
+            position++;
+
+        fields[count++] = QByteArray::fromRawData(data + fieldBegin, position - fieldBegin);
+    }
+
+    return count;
+}
+
+void CasparConnection::sendNotification()
+{
+    switch (AmcpConnection::command)
+    {
+        case AmcpConnection::CLS:
+        {
+            emit responseChanged(AmcpConnection::getResponseString(0));
+
+            QList<CasparMedia> items;
+            items.reserve(AmcpConnection::getResponseCount());
+
+            QString name;
+            QByteArray fields[5];
+            for (int i = 1; i < AmcpConnection::getResponseCount(); i++) // First post is the header, 200 CLS OK.
+            {
+                int count = parseListItem(AmcpConnection::getResponseLine(i), name, fields, 5);
+
+                QString type = (count > 0) ? QString::fromLatin1(fields[0].constData(), fields[0].length()) : QString();
+
+                QString timecode;
+                if (count > 4)
+                {
+                    int frames = parseInt(fields[3].constData(), fields[3].length());
+
+                    int fps = 0;
+                    int separator = fields[4].indexOf('/');
+                    if (separator >= 0)
+                        fps = parseInt(fields[4].constData() + separator + 1, fields[4].length() - separator - 1);
+
+                    if (fps > 0)
+                        timecode = convertToTimecode(frames * (1.0 / fps), fps);
+                }
+
+                items.push_back(CasparMedia(name, type, timecode));
+            }
+
+            emit mediaChanged(items);
+
+            break;
+        }
+        case AmcpConnection::TLS:
+        {
+            emit responseChanged(AmcpConnection::getResponseString(0));
+
+            QList<CasparTemplate> items;
+            items.reserve(AmcpConnection::getResponseCount());
+
+            QString name;
+            for (int i = 1; i < AmcpConnection::getResponseCount(); i++) // First post is the header, 200 TLS OK.
+            {
+                parseListItem(AmcpConnection::getResponseLine(i), name, NULL, 0);
+
+                items.push_back(CasparTemplate(name));
+            }
+
+            emit templateChanged(items);
+
+            break;
+        }
+        case AmcpConnection::INFO:
+        {
+            QList<QString> items;
+            for (int i = 1; i < AmcpConnection::getResponseCount(); i++) // First post is the header, 200 INFO OK.
+                items.push_back(AmcpConnection::getResponseString(i));
+
+            emit infoChanged(items);
+
+            break;
+        }
+        case AmcpConnection::INFOSYSTEM:
+        {
+            QList<QString> items;
+            for (int i = 1; i < AmcpConnection::getResponseCount(); i++) // First post is the header, 201 INFO SYSTEM OK.
+                items.push_back(AmcpConnection::getResponseString(i));
+
+            emit infoSystemChanged(items);
+
+            break;
+        }
+        case AmcpConnection::DATALIST:
+        {
+            emit responseChanged(AmcpConnection::getResponseString(0));
+
+            QList<CasparData> items;
+            items.reserve(AmcpConnection::getResponseCount());
+
+            QString name;
+            for (int i = 1; i < AmcpConnection::getResponseCount(); i++) // First post is the header, 200 DATA LIST OK.
+            {
+                parseListItem(AmcpConnection::getResponseLine(i), name, NULL, 0);
+
+                items.push_back(CasparData(name));
+            }
+
+            emit dataChanged(items);
+
+            break;
+        }
+        case AmcpConnection::THUMBNAILLIST:
+        {
+            emit responseChanged(AmcpConnection::getResponseString(0));
+
+            QList<CasparThumbnail> items;
+            items.reserve(AmcpConnection::getResponseCount());
+
+            QString name;
+            QByteArray fields[2];
+            for (int i = 1; i < AmcpConnection::getResponseCount(); i++) // First post is the header, 200 THUMBNAIL LIST OK.
+            {
+                int count = parseListItem(AmcpConnection::getResponseLine(i), name, fields, 2);
+                if (count < 2)
+                    continue;
+
+                items.push_back(CasparThumbnail(name, QString::fromLatin1(fields[0].constData(), fields[0].length()),
+                                                QString::fromLatin1(fields[1].constData(), fields[1].length())));
+            }
+
+            emit thumbnailChanged(items);
+
+            break;
+        }
+        case AmcpConnection::THUMBNAILRETRIEVE:
+        {
+            // First post is the header, 201 THUMBNAIL RETRIEVE OK.
+            if (AmcpConnection::getResponseCount() > 1)
+                emit thumbnailRetrieveChanged(AmcpConnection::getResponseString(1), AmcpConnection::getResponseTicket());
+
+            break;
+        }
+        case AmcpConnection::VERSION:
+        {
+            // First post is the header, 201 VERSION OK.
+            if (AmcpConnection::getResponseCount() > 1)
+                emit versionChanged(AmcpConnection::getResponseString(1));
+
+            break;
+        }
+        default:
+        {
+            if (AmcpConnection::getResponseCount() > 0)
+                emit responseChanged(AmcpConnection::getResponseString(0));
+
+            break;
+        }
+    }
+
+    resetResponse();
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "AmcpConnection.h"
+#include "Models/CasparData.h"
+#include "Models/CasparMedia.h"
+#include "Models/CasparTemplate.h"
+#include "Models/CasparThumbnail.h"
+
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+// Builds the models from the server replies in the network thread. The results are
+// handed to CasparDevice through queued signals, nothing is shared between the threads.
+class CASPAR_EXPORT CasparConnection : public AmcpConnection
+{
+    Q_OBJECT
+
+    public:
+        explicit CasparConnection(const QString& address, int port, QObject* parent = 0);
+
+        Q_SIGNAL void infoChanged(const QList<QString>&);
+        Q_SIGNAL void infoSystemChanged(const QList<QString>&);
+        Q_SIGNAL void mediaChanged(const QList<CasparMedia>&);
+        Q_SIGNAL void templateChanged(const QList<CasparTemplate>&);
+        Q_SIGNAL void dataChanged(const QList<CasparData>&);
+        Q_SIGNAL void versionChanged(const QString&);
+        Q_SIGNAL void responseChanged(const QString&);
+        Q_SIGNAL void thumbnailChanged(const QList<CasparThumbnail>&);
+        Q_SIGNAL void thumbnailRetrieveChanged(const QString&, int);
+
+    protected:
+        void sendNotification();
+
+    private:
+        QString convertToTimecode(double time, int fps);
+
+        static int parseInt(const char* data, int length);
+        static int parseListItem(const QByteArray& line, QString& name, QByteArray* fields, int maxFields);
+};
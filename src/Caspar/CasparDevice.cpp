@@ -1,733 +1,615 @@
 #include "CasparDevice.h"
+#include "HostResolver.h"
 
+#include <QtCore/QMetaType>
 #include <QtCore/QStringList>
 
-#include <QtNetwork/QHostInfo>
-
 CasparDevice::CasparDevice(const QString& address, int port, QObject* parent)
-    : AmcpDevice(address, port, parent)
+    : AmcpDevice(address, port, new CasparConnection(address, port), parent)
 {
+    qRegisterMetaType<QList<QString> >("QList<QString>");
+    qRegisterMetaType<QList<CasparMedia> >("QList<CasparMedia>");
+    qRegisterMetaType<QList<CasparTemplate> >("QList<CasparTemplate>");
+    qRegisterMetaType<QList<CasparData> >("QList<CasparData>");
+    qRegisterMetaType<QList<CasparThumbnail> >("QList<CasparThumbnail>");
+
+    QObject::connect(AmcpDevice::connection, SIGNAL(infoChanged(const QList<QString>&)), this, SLOT(notifyInfoChanged(const QList<QString>&)));
+    QObject::connect(AmcpDevice::connection, SIGNAL(infoSystemChanged(const QList<QString>&)), this, SLOT(notifyInfoSystemChanged(const QList<QString>&)));
+    QObject::connect(AmcpDevice::connection, SIGNAL(mediaChanged(const QList<CasparMedia>&)), this, SLOT(notifyMediaChanged(const QList<CasparMedia>&)));
+    QObject::connect(AmcpDevice::connection, SIGNAL(templateChanged(const QList<CasparTemplate>&)), this, SLOT(notifyTemplateChanged(const QList<CasparTemplate>&)));
+    QObject::connect(AmcpDevice::connection, SIGNAL(dataChanged(const QList<CasparData>&)), this, SLOT(notifyDataChanged(const QList<CasparData>&)));
+    QObject::connect(AmcpDevice::connection, SIGNAL(versionChanged(const QString&)), this, SLOT(notifyVersionChanged(const QString&)));
+    QObject::connect(AmcpDevice::connection, SIGNAL(responseChanged(const QString&)), this, SLOT(notifyResponseChanged(const QString&)));
+    QObject::connect(AmcpDevice::connection, SIGNAL(thumbnailChanged(const QList<CasparThumbnail>&)), this, SLOT(notifyThumbnailChanged(const QList<CasparThumbnail>&)));
+    QObject::connect(AmcpDevice::connection, SIGNAL(thumbnailRetrieveChanged(const QString&, int)), this, SLOT(notifyThumbnailRetrieveChanged(const QString&, int)));
+
+    QObject::connect(&HostResolver::getInstance(), SIGNAL(hostResolved(const QString&, const QString&)), this, SLOT(notifyHostResolved(const QString&, const QString&)));
 }
 
 const QString CasparDevice::resolveIpAddress() const
 {
-    if (AmcpDevice::getAddress() == "localhost")
-        return "127.0.0.1";
-
-    QHostAddress address(AmcpDevice::getAddress());
-    if (!address.isNull())
-        return getAddress(); // The ip address is valid.
-
-    // We don't have a valid ip address. Try to resolve using dns lookup.
-    QHostInfo hostInfo = QHostInfo::fromName(AmcpDevice::getAddress());
-    if (hostInfo.error() != QHostInfo::NoError)
-        return "";
-
-    if (hostInfo.addresses().isEmpty())
-        return "";
-
-    return hostInfo.addresses().at(0).toString();
+    return HostResolver::getInstance().resolve(AmcpDevice::getAddress());
 }
 
-void CasparDevice::refreshData()
+int CasparDevice::refreshData()
 {
-    writeMessage("DATA LIST");
+    return writeMessage(beginMessage().token(AmcpEncoder::DATA).token(AmcpEncoder::LIST));
 }
 
-void CasparDevice::refreshFlashVersion()
+int CasparDevice::refreshFlashVersion()
 {
-    writeMessage("VERSION FLASH");
+    return writeMessage(beginMessage().token(AmcpEncoder::VERSION).token(AmcpEncoder::FLASH));
 }
 
-void CasparDevice::refreshServerVersion()
+int CasparDevice::refreshServerVersion()
 {
-    writeMessage("VERSION SERVER");
+    return writeMessage(beginMessage().token(AmcpEncoder::VERSION).token(AmcpEncoder::SERVER));
 }
 
-void CasparDevice::refreshTemplateHostVersion()
+int CasparDevice::refreshTemplateHostVersion()
 {
-    writeMessage("VERSION TEMPLATEHOST");
+    return writeMessage(beginMessage().token(AmcpEncoder::VERSION).token(AmcpEncoder::TEMPLATEHOST));
 }
 
-void CasparDevice::refreshMedia()
+int CasparDevice::refreshMedia()
 {
-    writeMessage("CLS");
+    return writeMessage(beginMessage().token(AmcpEncoder::CLS));
 }
 
-void CasparDevice::refreshTemplate()
+int CasparDevice::refreshTemplate()
 {
-    writeMessage("TLS");
+    return writeMessage(beginMessage().token(AmcpEncoder::TLS));
 }
 
-void CasparDevice::refreshChannels()
+int CasparDevice::refreshChannels()
 {
-    writeMessage("INFO");
+    return writeMessage(beginMessage().token(AmcpEncoder::INFO));
 }
 
-void CasparDevice::refreshThumbnail()
+int CasparDevice::refreshThumbnail()
 {
-    writeMessage("THUMBNAIL LIST");
+    return writeMessage(beginMessage().token(AmcpEncoder::THUMBNAIL).token(AmcpEncoder::LIST));
 }
 
-void CasparDevice::retrieveThumbnail(const QString& name)
+int CasparDevice::retrieveThumbnail(const QString& name)
 {
-    writeMessage(QString("THUMBNAIL RETRIEVE \"%1\"").arg(name));
+    return writeMessage(beginMessage().token(AmcpEncoder::THUMBNAIL).token(AmcpEncoder::RETRIEVE).quoted(name));
 }
 
-void CasparDevice::sendCommand(const QString& command)
+int CasparDevice::sendCommand(const QString& command)
 {
-    writeMessage(QString("%1").arg(command));
+    return writeMessage(beginMessage().text(command.trimmed()));
 }
 
-void CasparDevice::clearChannel(int channel)
+int CasparDevice::clearChannel(int channel)
 {
-    writeMessage(QString("CLEAR %1").arg(channel));
+    return writeMessage(beginMessage().token(AmcpEncoder::CLEAR).integer(channel));
 }
 
-void CasparDevice::clearMixerChannel(int channel)
+int CasparDevice::clearMixerChannel(int channel)
 {
-    writeMessage(QString("MIXER %1 CLEAR").arg(channel));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).integer(channel).token(AmcpEncoder::CLEAR));
 }
 
-void CasparDevice::clearVideolayer(int channel, int videolayer)
+int CasparDevice::clearVideolayer(int channel, int videolayer)
 {
-    writeMessage(QString("CLEAR %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::CLEAR).layer(channel, videolayer));
 }
 
-void CasparDevice::clearMixerVideolayer(int channel, int videolayer)
+int CasparDevice::clearMixerVideolayer(int channel, int videolayer)
 {
-    writeMessage(QString("MIXER %1-%2 CLEAR").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::CLEAR));
 }
 
-void CasparDevice::setMasterVolume(int channel, float masterVolume)
+int CasparDevice::setMasterVolume(int channel, float masterVolume)
 {
-    writeMessage(QString("MIXER %1 MASTERVOLUME %2").arg(channel).arg(masterVolume));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).integer(channel).token(AmcpEncoder::MASTERVOLUME)
+                        .real(masterVolume));
 }
 
-void CasparDevice::addTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad)
+int CasparDevice::addTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad)
 {
-    writeMessage(QString("CG %1-%2 ADD %3 \"%4\" %5")
-                 .arg(channel).arg(videolayer).arg(flashlayer).arg(name)
-                 .arg((playOnLoad == true) ? "1" : "0"));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::ADD)
+                        .integer(flashlayer).quoted(name).integer((playOnLoad == true) ? 1 : 0));
 }
 
-void CasparDevice::addTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad,
-                               const QString& data)
+int CasparDevice::addTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad,
+                              const QString& data)
 {
-    writeMessage(QString("CG %1-%2 ADD %3 %4 \"%5\" \"%6\"")
-                 .arg(channel).arg(videolayer).arg(flashlayer).arg(name)
-                 .arg((playOnLoad == true) ? "1" : "0").arg(data));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::ADD)
+                        .integer(flashlayer).quoted(name).integer((playOnLoad == true) ? 1 : 0).quoted(data));
 }
 
-void CasparDevice::invokeTemplate(int channel, int videolayer, int flashlayer, const QString& label)
+int CasparDevice::invokeTemplate(int channel, int videolayer, int flashlayer, const QString& label)
 {
-    writeMessage(QString("CG %1-%2 INVOKE %3 %4")
-                 .arg(channel).arg(videolayer).arg(flashlayer).arg(label));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::INVOKE)
+                        .integer(flashlayer).text(label));
 }
 
-void CasparDevice::nextTemplate(int channel, int videolayer, int flashlayer)
+int CasparDevice::nextTemplate(int channel, int videolayer, int flashlayer)
 {
-    writeMessage(QString("CG %1-%2 NEXT %3")
-                 .arg(channel).arg(videolayer).arg(flashlayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::NEXT)
+                        .integer(flashlayer));
 }
 
-void CasparDevice::playTemplate(int channel, int videolayer, int flashlayer)
+int CasparDevice::playTemplate(int channel, int videolayer, int flashlayer)
 {
-    writeMessage(QString("CG %1-%2 PLAY %3")
-                 .arg(channel).arg(videolayer).arg(flashlayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::PLAY)
+                        .integer(flashlayer));
 }
 
-void CasparDevice::playTemplate(int channel, int videolayer, int flashlayer, const QString& name)
+int CasparDevice::playTemplate(int channel, int videolayer, int flashlayer, const QString& name)
 {
-    writeMessage(QString("CG %1-%2 ADD %3 \"%4\" 1")
-                 .arg(channel).arg(videolayer).arg(flashlayer).arg(name));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::ADD)
+                        .integer(flashlayer).quoted(name).integer(1));
 }
 
-void CasparDevice::playTemplate(int channel, int videolayer, int flashlayer, const QString& name, const QString& data)
+int CasparDevice::playTemplate(int channel, int videolayer, int flashlayer, const QString& name, const QString& data)
 {
-    writeMessage(QString("CG %1-%2 ADD %3 \"%4\" 1 \"%5\"")
-                 .arg(channel).arg(videolayer).arg(flashlayer).arg(name).arg(data));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::ADD)
+                        .integer(flashlayer).quoted(name).integer(1).quoted(data));
 }
 
-void CasparDevice::removeTemplate(int channel, int videolayer, int flashlayer)
+int CasparDevice::removeTemplate(int channel, int videolayer, int flashlayer)
 {
-    writeMessage(QString("CG %1-%2 REMOVE %3")
-                 .arg(channel).arg(videolayer).arg(flashlayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::REMOVE)
+                        .integer(flashlayer));
 }
 
-void CasparDevice::stopTemplate(int channel, int videolayer, int flashlayer)
+int CasparDevice::stopTemplate(int channel, int videolayer, int flashlayer)
 {
-    writeMessage(QString("CG %1-%2 STOP %3")
-                 .arg(channel).arg(videolayer).arg(flashlayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::STOP)
+                        .integer(flashlayer));
 }
 
-void CasparDevice::updateTemplate(int channel, int videolayer, int flashlayer, const QString& data)
+int CasparDevice::updateTemplate(int channel, int videolayer, int flashlayer, const QString& data)
 {
-    writeMessage(QString("CG %1-%2 UPDATE %3 \"%4\"")
-                 .arg(channel).arg(videolayer).arg(flashlayer).arg(data));
+    return writeMessage(beginMessage().token(AmcpEncoder::CG).layer(channel, videolayer).token(AmcpEncoder::UPDATE)
+                        .integer(flashlayer).quoted(data));
 }
 
-void CasparDevice::pauseVideo(int channel, int videolayer)
+int CasparDevice::pauseVideo(int channel, int videolayer)
 {
-    writeMessage(QString("PAUSE %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PAUSE).layer(channel, videolayer));
 }
 
-void CasparDevice::playVideo(int channel, int videolayer)
+int CasparDevice::playVideo(int channel, int videolayer)
 {
-    writeMessage(QString("PLAY %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer));
 }
 
-void CasparDevice::playVideo(int channel, int videolayer, const QString& name, const QString &transition, int duration,
-                             const QString& easing, const QString& direction, int seek, int length, bool loop, bool useAuto)
+int CasparDevice::playVideo(int channel, int videolayer, const QString& name, const QString &transition, int duration,
+                            const QString& easing, const QString& direction, int seek, int length, bool loop, bool useAuto)
 {
     if (useAuto)
-        loadVideo(channel, videolayer, name, transition, duration, easing, direction, seek, length, loop, false, useAuto);
+        return loadVideo(channel, videolayer, name, transition, duration, easing, direction, seek, length, loop, false, useAuto);
     else
-        writeMessage(QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7 %8 %9 %10")
-                     .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                     .arg(direction)
-                     .arg((seek > 0) ? QString("SEEK %1").arg(seek) : "")
-                     .arg((length > 0) ? QString("LENGTH %1").arg(length) : "")
-                     .arg((loop == true) ? "LOOP" : ""));
+        return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer).quoted(name).text(transition)
+                            .easing(duration, easing).text(direction)
+                            .option(seek > 0, AmcpEncoder::SEEK, seek)
+                            .option(length > 0, AmcpEncoder::LENGTH, length)
+                            .option(loop, AmcpEncoder::LOOP));
 }
 
-void CasparDevice::loadVideo(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                             const QString& easing, const QString& direction, int seek, int length, bool loop,
-                             bool freezeOnLoad, bool useAuto)
+int CasparDevice::loadVideo(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                            const QString& easing, const QString& direction, int seek, int length, bool loop,
+                            bool freezeOnLoad, bool useAuto)
 {
-    writeMessage(QString("%1 %2-%3 \"%4\" %5 %6 %7 %8 %9 %10 %11 %12")
-                 .arg((freezeOnLoad == true) ? "LOAD" : "LOADBG")
-                 .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                 .arg(direction)
-                 .arg((seek > 0) ? QString("SEEK %1").arg(seek) : "")
-                 .arg((length > 0) ? QString("LENGTH %1").arg(length) : "")
-                 .arg((loop == true) ? "LOOP" : "")
-                 .arg((useAuto == true) ? "AUTO" : ""));
+    return writeMessage(beginMessage().token((freezeOnLoad == true) ? AmcpEncoder::LOAD : AmcpEncoder::LOADBG)
+                        .layer(channel, videolayer).quoted(name).text(transition).easing(duration, easing).text(direction)
+                        .option(seek > 0, AmcpEncoder::SEEK, seek)
+                        .option(length > 0, AmcpEncoder::LENGTH, length)
+                        .option(loop, AmcpEncoder::LOOP)
+                        .option(useAuto, AmcpEncoder::AUTO));
 }
 
-void CasparDevice::stopVideo(int channel, int videolayer)
+int CasparDevice::stopVideo(int channel, int videolayer)
 {
-    writeMessage(QString("STOP %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::STOP).layer(channel, videolayer));
 }
 
-void CasparDevice::pauseAudio(int channel, int videolayer)
+int CasparDevice::pauseAudio(int channel, int videolayer)
 {
-    writeMessage(QString("PAUSE %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PAUSE).layer(channel, videolayer));
 }
 
-void CasparDevice::playAudio(int channel, int videolayer)
+int CasparDevice::playAudio(int channel, int videolayer)
 {
-    writeMessage(QString("PLAY %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer));
 }
 
-void CasparDevice::playAudio(int channel, int videolayer, const QString& name, const QString &transition, int duration,
-                             const QString& easing, const QString& direction, bool loop, bool useAuto)
+int CasparDevice::playAudio(int channel, int videolayer, const QString& name, const QString &transition, int duration,
+                            const QString& easing, const QString& direction, bool loop, bool useAuto)
 {
     if (useAuto)
-        loadAudio(channel, videolayer, name, transition, duration, easing, direction, loop, useAuto);
+        return loadAudio(channel, videolayer, name, transition, duration, easing, direction, loop, useAuto);
     else
-        writeMessage(QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7 %8")
-                     .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                     .arg(direction)
-                     .arg((loop == true) ? "LOOP" : ""));
+        return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer).quoted(name).text(transition)
+                            .easing(duration, easing).text(direction)
+                            .option(loop, AmcpEncoder::LOOP));
 }
 
-void CasparDevice::loadAudio(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                             const QString& easing, const QString& direction, bool loop, bool useAuto)
+int CasparDevice::loadAudio(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                            const QString& easing, const QString& direction, bool loop, bool useAuto)
 {
-    writeMessage(QString("LOADBG %1-%2 \"%3\" %4 %5 %6 %7 %8 %9")
-                 .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                 .arg(direction)
-                 .arg((loop == true) ? "LOOP" : "")
-                 .arg((useAuto == true) ? "AUTO" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::LOADBG).layer(channel, videolayer).quoted(name).text(transition)
+                        .easing(duration, easing).text(direction)
+                        .option(loop, AmcpEncoder::LOOP)
+                        .option(useAuto, AmcpEncoder::AUTO));
 }
 
-void CasparDevice::stopAudio(int channel, int videolayer)
+int CasparDevice::stopAudio(int channel, int videolayer)
 {
-    writeMessage(QString("STOP %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::STOP).layer(channel, videolayer));
 }
 
-void CasparDevice::pauseColor(int channel, int videolayer)
+int CasparDevice::pauseColor(int channel, int videolayer)
 {
-    writeMessage(QString("PAUSE %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PAUSE).layer(channel, videolayer));
 }
 
-void CasparDevice::playColor(int channel, int videolayer)
+int CasparDevice::playColor(int channel, int videolayer)
 {
-    writeMessage(QString("PLAY %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer));
 }
 
-void CasparDevice::playColor(int channel, int videolayer, const QString& name, const QString &transition, int duration,
-                             const QString& easing, const QString& direction, bool useAuto)
+int CasparDevice::playColor(int channel, int videolayer, const QString& name, const QString &transition, int duration,
+                            const QString& easing, const QString& direction, bool useAuto)
 {
     if (useAuto)
-        loadColor(channel, videolayer, name, transition, duration, easing, direction, useAuto);
+        return loadColor(channel, videolayer, name, transition, duration, easing, direction, useAuto);
     else
-        writeMessage(QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7")
-                     .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                     .arg(direction));
+        return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer).quoted(name).text(transition)
+                            .easing(duration, easing).text(direction));
 }
 
-void CasparDevice::loadColor(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                             const QString& easing, const QString& direction, bool useAuto)
+int CasparDevice::loadColor(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                            const QString& easing, const QString& direction, bool useAuto)
 {
-    writeMessage(QString("LOADBG %1-%2 \"%3\" %4 %5 %6 %7 %8")
-                 .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                 .arg(direction)
-                 .arg((useAuto == true) ? "AUTO" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::LOADBG).layer(channel, videolayer).quoted(name).text(transition)
+                        .easing(duration, easing).text(direction)
+                        .option(useAuto, AmcpEncoder::AUTO));
 }
 
-void CasparDevice::stopColor(int channel, int videolayer)
+int CasparDevice::stopColor(int channel, int videolayer)
 {
-    writeMessage(QString("STOP %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::STOP).layer(channel, videolayer));
 }
 
-void CasparDevice::pauseImage(int channel, int videolayer)
+int CasparDevice::pauseImage(int channel, int videolayer)
 {
-    writeMessage(QString("PAUSE %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PAUSE).layer(channel, videolayer));
 }
 
-void CasparDevice::playImage(int channel, int videolayer)
+int CasparDevice::playImage(int channel, int videolayer)
 {
-    writeMessage(QString("PLAY %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer));
 }
 
-void CasparDevice::playImage(int channel, int videolayer, const QString& name, const QString &transition, int duration,
-                             const QString& easing, const QString& direction, bool useAuto)
+int CasparDevice::playImage(int channel, int videolayer, const QString& name, const QString &transition, int duration,
+                            const QString& easing, const QString& direction, bool useAuto)
 {
     if (useAuto)
-        loadImage(channel, videolayer, name, transition, duration, easing, direction, useAuto);
+        return loadImage(channel, videolayer, name, transition, duration, easing, direction, useAuto);
     else
-        writeMessage(QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7")
-                     .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                     .arg(direction));
+        return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer).quoted(name).text(transition)
+                            .easing(duration, easing).text(direction));
 }
 
-void CasparDevice::loadImage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                             const QString& easing, const QString& direction, bool useAuto)
+int CasparDevice::loadImage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                            const QString& easing, const QString& direction, bool useAuto)
 {
-    writeMessage(QString("LOADBG %1-%2 \"%3\" %4 %5 %6 %7")
-                 .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                 .arg(direction)
-                 .arg((useAuto == true) ? "AUTO" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::LOADBG).layer(channel, videolayer).quoted(name).text(transition)
+                        .easing(duration, easing).text(direction)
+                        .option(useAuto, AmcpEncoder::AUTO));
 }
 
-void CasparDevice::stopImage(int channel, int videolayer)
+int CasparDevice::stopImage(int channel, int videolayer)
 {
-    writeMessage(QString("STOP %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::STOP).layer(channel, videolayer));
 }
 
-void CasparDevice::startRecording(int channel, const QString& filename, const QString& codec, const QString& preset,
-                                  const QString& tune, bool withAlpha)
+int CasparDevice::startRecording(int channel, const QString& filename, const QString& codec, const QString& preset,
+                                 const QString& tune, bool withAlpha)
 {
-    writeMessage(QString("ADD %1 FILE \"%2\" -vcodec %3 %4 %5 %6")
-                 .arg(channel).arg(filename).arg(codec)
-                 .arg((preset != "") ? QString("-preset %1").arg(preset) : "")
-                 .arg((tune != "") ? QString("-tune %1").arg(tune) : "")
-                 .arg((withAlpha == true) ? "SEPARATE_KEY" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::ADD).integer(channel).token(AmcpEncoder::FILE).quoted(filename)
+                        .token(AmcpEncoder::VCODEC).text(codec)
+                        .option(preset != "", AmcpEncoder::PRESET, preset)
+                        .option(tune != "", AmcpEncoder::TUNE, tune)
+                        .option(withAlpha, AmcpEncoder::SEPARATE_KEY));
 }
 
-void CasparDevice::stopRecording(int channel)
+int CasparDevice::stopRecording(int channel)
 {
-    writeMessage(QString("REMOVE %1 FILE").arg(channel));
+    return writeMessage(beginMessage().token(AmcpEncoder::REMOVE).integer(channel).token(AmcpEncoder::FILE));
 }
 
-void CasparDevice::print(int channel, const QString& output)
+int CasparDevice::print(int channel, const QString& output)
 {
-    writeMessage(QString("ADD %1 IMAGE \"%2\"").arg(channel).arg(output));
+    return writeMessage(beginMessage().token(AmcpEncoder::ADD).integer(channel).token(AmcpEncoder::IMAGE).quoted(output));
 }
 
-void CasparDevice::pauseDeviceInput(int channel, int videolayer)
+int CasparDevice::pauseDeviceInput(int channel, int videolayer)
 {
-    writeMessage(QString("PAUSE %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PAUSE).layer(channel, videolayer));
 }
 
-void CasparDevice::playDeviceInput(int channel, int videolayer)
+int CasparDevice::playDeviceInput(int channel, int videolayer)
 {
-    writeMessage(QString("PLAY %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer));
 }
 
-void CasparDevice::playDeviceInput(int channel, int videolayer, int device, const QString& format)
+int CasparDevice::playDeviceInput(int channel, int videolayer, int device, const QString& format)
 {
-    writeMessage(QString("PLAY %1-%2 DECKLINK DEVICE %3 FORMAT %4")
-                 .arg(channel).arg(videolayer).arg(device).arg(format));
+    return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer).token(AmcpEncoder::DECKLINK)
+                        .token(AmcpEncoder::DEVICE).integer(device).token(AmcpEncoder::FORMAT).text(format));
 }
 
-void CasparDevice::loadDeviceInput(int channel, int videolayer, int device, const QString& format)
+int CasparDevice::loadDeviceInput(int channel, int videolayer, int device, const QString& format)
 {
-    writeMessage(QString("LOADBG %1-%2 DECKLINK DEVICE %3 FORMAT %4")
-                 .arg(channel).arg(videolayer).arg(device).arg(format));
+    return writeMessage(beginMessage().token(AmcpEncoder::LOADBG).layer(channel, videolayer).token(AmcpEncoder::DECKLINK)
+                        .token(AmcpEncoder::DEVICE).integer(device).token(AmcpEncoder::FORMAT).text(format));
 }
 
-void CasparDevice::stopDeviceInput(int channel, int videolayer)
+int CasparDevice::stopDeviceInput(int channel, int videolayer)
 {
-    writeMessage(QString("STOP %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::STOP).layer(channel, videolayer));
 }
 
-void CasparDevice::pauseImageScroll(int channel, int videolayer)
+int CasparDevice::pauseImageScroll(int channel, int videolayer)
 {
-    writeMessage(QString("PAUSE %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PAUSE).layer(channel, videolayer));
 }
 
-void CasparDevice::playImageScroll(int channel, int videolayer)
+int CasparDevice::playImageScroll(int channel, int videolayer)
 {
-    writeMessage(QString("PLAY %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer));
 }
 
-void CasparDevice::playImageScroll(int channel, int videolayer, const QString& name, int blur, int speed,
-                                   bool premultiply, bool progressive)
+int CasparDevice::playImageScroll(int channel, int videolayer, const QString& name, int blur, int speed,
+                                  bool premultiply, bool progressive)
 {
-    writeMessage(QString("PLAY %1-%2 \"%3\" BLUR %4 SPEED %5 %6 %7")
-                 .arg(channel).arg(videolayer).arg(name).arg(blur).arg(speed)
-                 .arg((premultiply == true) ? "PREMULTIPLY" : "")
-                 .arg((progressive == true) ? "PROGRESSIVE" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::PLAY).layer(channel, videolayer).quoted(name)
+                        .token(AmcpEncoder::BLUR).integer(blur).token(AmcpEncoder::SPEED).integer(speed)
+                        .option(premultiply, AmcpEncoder::PREMULTIPLY)
+                        .option(progressive, AmcpEncoder::PROGRESSIVE));
 }
 
-void CasparDevice::loadImageScroll(int channel, int videolayer, const QString& name, int blur, int speed,
-                                   bool premultiply, bool progressive)
+int CasparDevice::loadImageScroll(int channel, int videolayer, const QString& name, int blur, int speed,
+                                  bool premultiply, bool progressive)
 {
-    writeMessage(QString("LOADBG %1-%2 \"%3\" BLUR %4 SPEED %5 %6 %7")
-                 .arg(channel).arg(videolayer).arg(name).arg(blur).arg(speed)
-                 .arg((premultiply == true) ? "PREMULTIPLY" : "")
-                 .arg((progressive == true) ? "PROGRESSIVE" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::LOADBG).layer(channel, videolayer).quoted(name)
+                        .token(AmcpEncoder::BLUR).integer(blur).token(AmcpEncoder::SPEED).integer(speed)
+                        .option(premultiply, AmcpEncoder::PREMULTIPLY)
+                        .option(progressive, AmcpEncoder::PROGRESSIVE));
 }
 
-void CasparDevice::stopImageScroll(int channel, int videolayer)
+int CasparDevice::stopImageScroll(int channel, int videolayer)
 {
-    writeMessage(QString("STOP %1-%2").arg(channel).arg(videolayer));
+    return writeMessage(beginMessage().token(AmcpEncoder::STOP).layer(channel, videolayer));
 }
 
-void CasparDevice::setCommit(int channel)
+int CasparDevice::setCommit(int channel)
 {
-    writeMessage(QString("MIXER %1 COMMIT").arg(channel));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).integer(channel).token(AmcpEncoder::COMMIT));
 }
 
-void CasparDevice::setChroma(int channel, int videolayer, const QString& key, float threshold, float spread, float spill, float blur, bool mask)
+int CasparDevice::setChroma(int channel, int videolayer, const QString& key, float threshold, float spread, float spill, float blur, bool mask)
 {
-    writeMessage(QString("MIXER %1-%2 CHROMA %3 %4 %5 %6 %7 %8")
-                 .arg(channel).arg(videolayer).arg(key).arg(threshold).arg(spread).arg(spill).arg(blur).arg(mask));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::CHROMA)
+                        .text(key).real(threshold).real(spread).real(spill).real(blur).integer((mask == true) ? 1 : 0));
 }
 
-void CasparDevice::setBlendMode(int channel, int videolayer, const QString& blendMode)
+int CasparDevice::setBlendMode(int channel, int videolayer, const QString& blendMode)
 {
-    writeMessage(QString("MIXER %1-%2 BLEND %3")
-                 .arg(channel).arg(videolayer).arg(blendMode));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::BLEND)
+                        .text(blendMode));
 }
 
-void CasparDevice::setGrid(int channel, int grid, int duration, const QString& easing, bool defer)
+int CasparDevice::setGrid(int channel, int grid, int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1 GRID %2 %3 %4 %5")
-                 .arg(channel).arg(grid).arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).integer(channel).token(AmcpEncoder::GRID)
+                        .integer(grid).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setKeyer(int channel, int videolayer, int keyer, bool defer)
+int CasparDevice::setKeyer(int channel, int videolayer, int keyer, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 KEYER %3 %4")
-                 .arg(channel).arg(videolayer).arg(keyer)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::KEYER)
+                        .integer(keyer)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setVolume(int channel, int videolayer, float volume, bool defer)
+int CasparDevice::setVolume(int channel, int videolayer, float volume, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 VOLUME %3 %4")
-                 .arg(channel).arg(videolayer).arg(volume)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::VOLUME)
+                        .real(volume)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setVolume(int channel, int videolayer, float volume, int duration, const QString& easing, bool defer)
+int CasparDevice::setVolume(int channel, int videolayer, float volume, int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 VOLUME %3 %4 %5 %6")
-                 .arg(channel).arg(videolayer).arg(volume).arg(duration)
-                 .arg(easing).arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::VOLUME)
+                        .real(volume).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setOpacity(int channel, int videolayer, float opacity, bool defer)
+int CasparDevice::setOpacity(int channel, int videolayer, float opacity, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 OPACITY %3 %4")
-                 .arg(channel).arg(videolayer).arg(opacity)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::OPACITY)
+                        .real(opacity)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setOpacity(int channel, int videolayer, float opacity, int duration, const QString& easing, bool defer)
+int CasparDevice::setOpacity(int channel, int videolayer, float opacity, int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 OPACITY %3 %4 %5 %6")
-                 .arg(channel).arg(videolayer).arg(opacity).arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::OPACITY)
+                        .real(opacity).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setBrightness(int channel, int videolayer, float brightness, bool defer)
+int CasparDevice::setBrightness(int channel, int videolayer, float brightness, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 BRIGHTNESS %3 %4")
-                 .arg(channel).arg(videolayer).arg(brightness)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::BRIGHTNESS)
+                        .real(brightness)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setBrightness(int channel, int videolayer, float brightness, int duration, const QString& easing, bool defer)
+int CasparDevice::setBrightness(int channel, int videolayer, float brightness, int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 BRIGHTNESS %3 %4 %5 %6")
-                .arg(channel).arg(videolayer).arg(brightness).arg(duration).arg(easing)
-                .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::BRIGHTNESS)
+                        .real(brightness).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setContrast(int channel, int videolayer, float contrast, bool defer)
+int CasparDevice::setContrast(int channel, int videolayer, float contrast, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 CONTRAST %3 %4")
-                 .arg(channel).arg(videolayer).arg(contrast)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::CONTRAST)
+                        .real(contrast)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setContrast(int channel, int videolayer, float contrast, int duration, const QString& easing, bool defer)
+int CasparDevice::setContrast(int channel, int videolayer, float contrast, int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 CONTRAST %3 %4 %5 %6")
-                 .arg(channel).arg(videolayer).arg(contrast).arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::CONTRAST)
+                        .real(contrast).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setSaturation(int channel, int videolayer, float saturation, bool defer)
+int CasparDevice::setSaturation(int channel, int videolayer, float saturation, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 SATURATION %3 %4")
-                 .arg(channel).arg(videolayer).arg(saturation)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::SATURATION)
+                        .real(saturation)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setSaturation(int channel, int videolayer, float saturation, int duration, const QString& easing, bool defer)
+int CasparDevice::setSaturation(int channel, int videolayer, float saturation, int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 SATURATION %3 %4 %5 %6")
-                 .arg(channel).arg(videolayer).arg(saturation).arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::SATURATION)
+                        .real(saturation).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
-                             bool defer)
+int CasparDevice::setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
+                            bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 LEVELS %3 %4 %5 %6 %7 %8")
-                 .arg(channel).arg(videolayer).arg(minIn).arg(maxIn).arg(gamma).arg(minOut).arg(maxOut)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::LEVELS)
+                        .real(minIn).real(maxIn).real(gamma).real(minOut).real(maxOut)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
-                             int duration, const QString& easing, bool defer)
+int CasparDevice::setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
+                            int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 LEVELS %3 %4 %5 %6 %7 %8 %9 %10")
-                 .arg(channel).arg(videolayer).arg(minIn).arg(maxIn).arg(gamma).arg(minOut).arg(maxOut)
-                 .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::LEVELS)
+                        .real(minIn).real(maxIn).real(gamma).real(minOut).real(maxOut).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
-                               bool defer)
+int CasparDevice::setGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                              bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 FILL %3 %4 %5 %6 %7")
-                 .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX).arg(scaleY)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::FILL)
+                        .real(positionX).real(positionY).real(scaleX).real(scaleY)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
-                               int duration, const QString& easing, bool defer)
+int CasparDevice::setGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                              int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 FILL %3 %4 %5 %6 %7 %8 %9")
-                 .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX).arg(scaleY)
-                 .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::FILL)
+                        .real(positionX).real(positionY).real(scaleX).real(scaleY).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
-                               bool defer)
+int CasparDevice::setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                              bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 CLIP %3 %4 %5 %6 %7")
-                 .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX)
-                 .arg(scaleY).arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::CLIP)
+                        .real(positionX).real(positionY).real(scaleX).real(scaleY)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-void CasparDevice::setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
-                               int duration, const QString& easing, bool defer)
+int CasparDevice::setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                              int duration, const QString& easing, bool defer)
 {
-    writeMessage(QString("MIXER %1-%2 CLIP %3 %4 %5 %6 %7 %8 %9")
-                 .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX).arg(scaleY)
-                 .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+    return writeMessage(beginMessage().token(AmcpEncoder::MIXER).layer(channel, videolayer).token(AmcpEncoder::CLIP)
+                        .real(positionX).real(positionY).real(scaleX).real(scaleY).easing(duration, easing)
+                        .option(defer, AmcpEncoder::DEFER));
 }
 
-QString CasparDevice::convertToTimecode(double time, int fps)
+void CasparDevice::notifyInfoChanged(const QList<QString>& items)
 {
-    QString smpteFormat;
-
-    int hour = (int)(time / 3600);
-    int minutes = (int)((time - hour * 3600) / 60);
-    int seconds = (int)(time - hour * 3600 - minutes * 60);
-    int frames = (int)((time - hour * 3600 - minutes * 60 - seconds) * fps);
-
-    return smpteFormat.sprintf("%02d:%02d:%02d:%02d", hour, minutes, seconds, frames);
+    emit infoChanged(items, *this);
 }
 
-void CasparDevice::sendNotification()
+void CasparDevice::notifyInfoSystemChanged(const QList<QString>& items)
 {
-    switch (AmcpDevice::command)
-    {
-        case AmcpDevice::CLS:
-        {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 CLS OK.
-
-            QList<CasparMedia> items;
-            foreach (QString response, AmcpDevice::response)
-            {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                QString type = response.split("\" ").at(1).trimmed().split(" ").at(0);
-
-                QString timecode;
-                if (response.split("\" ").at(1).trimmed().split(" ").count() > 5)
-                {
-                    // Format:
-                    // "AMB"  MOVIE  6445960 20121101160514 643 1/60
-                    // "CG1080I50"  MOVIE  6159792 20121101150514 264 1/25
-                    // "GO1080P25"  MOVIE  16694084 20121101150514 445 1/25
-                    // "WIPE"  MOVIE  1268784 20121101150514 31 1/25
-                    QString totalFrames = response.split("\" ").at(1).trimmed().split(" ").at(4);
-                    QString timebase = response.split("\" ").at(1).trimmed().split(" ").at(5);
-
-                    int frames = totalFrames.toInt();
-                    int fps = timebase.split("/").at(1).toInt();
-
-                    double time = frames * (1.0 / fps);
-                    timecode = convertToTimecode(time, fps);
-                }
-
-                items.push_back(CasparMedia(name, type, timecode));
-            }
-
-            emit mediaChanged(items, *this);
-
-            break;
-        }
-        case AmcpDevice::TLS:
-        {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 TLS OK.
-
-            QList<CasparTemplate> items;
-            foreach (QString response, AmcpDevice::response)
-            {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                items.push_back(CasparTemplate(name));
-            }
-
-            emit templateChanged(items, *this);
-
-            break;
-        }       
-        case AmcpDevice::INFO:
-        {
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 INFO OK.
-            emit infoChanged(AmcpDevice::response, *this);
-
-            break;
-        }
-        case AmcpDevice::INFOSYSTEM:
-        {
-            AmcpDevice::response.removeFirst(); // First post is the header, 201 INFO SYSTEM OK.
-
-            emit infoSystemChanged(AmcpDevice::response, *this);
-
-            break;
-        }
-        case AmcpDevice::DATALIST:
-        {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 DATA LIST OK.
-
-            QList<CasparData> items;
-            foreach (QString response, AmcpDevice::response)
-            {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
-
-                items.push_back(CasparData(name));
-            }
-
-            emit dataChanged(items, *this);
-
-            break;
-        }
-        case AmcpDevice::THUMBNAILLIST:
-        {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 THUMBNAIL LIST OK.
-
-            QList<CasparThumbnail> items;
-            foreach (QString response, AmcpDevice::response)
-            {
-                QString name = response.split("\" ").at(0);
-                name.replace("\\", "/");
-                if (name.startsWith("\""))
-                    name.remove(0, 1);
-
-                if (name.endsWith("\""))
-                    name.remove(name.length() - 1, 1);
+    emit infoSystemChanged(items, *this);
+}
 
-                QString timestamp = response.split("\" ").at(1).trimmed().split(" ").at(0);
-                QString size = response.split("\" ").at(1).trimmed().split(" ").at(1);
+void CasparDevice::notifyMediaChanged(const QList<CasparMedia>& items)
+{
+    emit mediaChanged(items, *this);
+}
 
-                items.push_back(CasparThumbnail(name, timestamp, size));
-            }
+void CasparDevice::notifyTemplateChanged(const QList<CasparTemplate>& items)
+{
+    emit templateChanged(items, *this);
+}
 
-            emit thumbnailChanged(items, *this);
+void CasparDevice::notifyDataChanged(const QList<CasparData>& items)
+{
+    emit dataChanged(items, *this);
+}
 
-            break;
-        }
-        case AmcpDevice::THUMBNAILRETRIEVE:
-        {
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 THUMBNAIL RETRIEVE OK.
+void CasparDevice::notifyVersionChanged(const QString& version)
+{
+    emit versionChanged(version, *this);
+}
 
-            emit thumbnailRetrieveChanged(AmcpDevice::response.at(0), *this);
+void CasparDevice::notifyResponseChanged(const QString& response)
+{
+    emit responseChanged(response, *this);
+}
 
-            break;
-        }
-        case AmcpDevice::VERSION:
-        {
-            AmcpDevice::response.removeFirst(); // First post is the header, 200 VERSION OK.
+void CasparDevice::notifyThumbnailChanged(const QList<CasparThumbnail>& items)
+{
+    emit thumbnailChanged(items, *this);
+}
 
-            emit versionChanged(AmcpDevice::response.at(0), *this);
+void CasparDevice::notifyThumbnailRetrieveChanged(const QString& data, int ticket)
+{
+    emit thumbnailRetrieveChanged(data, ticket, *this);
+}
 
-            break;
-        }
+void CasparDevice::sendNotification()
+{
+    switch (AmcpDevice::command)
+    {
         case AmcpDevice::CONNECTIONSTATE:
         {
+            // The server may have come back on another address, refresh the cached one.
+            if (AmcpDevice::isConnected())
+                HostResolver::getInstance().invalidate(AmcpDevice::getAddress());
+
             emit connectionStateChanged(*this);
 
             break;
         }
         default:
         {
-            emit responseChanged(AmcpDevice::response.at(0), *this);
-
             break;
         }
     }
 
     resetDevice();
 }
+
+void CasparDevice::notifyHostResolved(const QString& host, const QString& address)
+{
+    Q_UNUSED(address);
+
+    if (host == AmcpDevice::getAddress())
+        emit ipAddressChanged(*this);
+}
@@ -3,6 +3,7 @@
 #include "Shared.h"
 
 #include "AmcpDevice.h"
+#include "CasparConnection.h"
 #include "Models/CasparData.h"
 #include "Models/CasparMedia.h"
 #include "Models/CasparTemplate.h"
@@ -15,118 +16,120 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
     public:
         explicit CasparDevice(const QString& address, int port = 5250, QObject* parent = 0);
 
+        // Never blocks, returns an empty string until a host name has been resolved, see ipAddressChanged().
         const QString resolveIpAddress() const;
 
-        void refreshData();
-        void refreshMedia();
-        void refreshTemplate();
-        void refreshChannels();
-        void refreshThumbnail();
-
-        void refreshFlashVersion();
-        void refreshServerVersion();
-        void refreshTemplateHostVersion();
-
-        void retrieveThumbnail(const QString& name);
-
-        void sendCommand(const QString& command);
-
-        void clearChannel(int channel);
-        void clearMixerChannel(int channel);
-        void clearVideolayer(int channel, int videolayer);
-        void clearMixerVideolayer(int channel, int videolayer);
-
-        void setMasterVolume(int channel, float masterVolume);
-
-        void addTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad);
-        void addTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad, const QString& data);
-        void invokeTemplate(int channel, int videolayer, int flashlayer, const QString& label);
-        void nextTemplate(int channel, int videolayer, int flashlayer);
-        void playTemplate(int channel, int videolayer, int flashlayer);
-        void playTemplate(int channel, int videolayer, int flashlayer, const QString& name);
-        void playTemplate(int channel, int videolayer, int flashlayer, const QString& name, const QString& data);
-        void removeTemplate(int channel, int videolayer, int flashlayer);
-        void stopTemplate(int channel, int videolayer, int flashlayer);
-        void updateTemplate(int channel, int videolayer, int flashlayer, const QString& data);
-
-        void pauseVideo(int channel, int videolayer);
-        void playVideo(int channel, int videolayer);
-        void playVideo(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                       const QString& easing, const QString& direction, int seek, int length, bool loop, bool useAuto);
-        void loadVideo(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                       const QString& easing, const QString& direction, int seek, int length, bool loop, bool freezeOnLoad, bool useAuto);
-        void stopVideo(int channel, int videolayer);
-
-        void pauseAudio(int channel, int videolayer);
-        void playAudio(int channel, int videolayer);
-        void playAudio(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                       const QString& easing, const QString& direction, bool loop, bool useAuto);
-        void loadAudio(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                       const QString& easing, const QString& direction, bool loop, bool useAuto);
-        void stopAudio(int channel, int videolayer);
-
-        void pauseColor(int channel, int videolayer);
-        void playColor(int channel, int videolayer);
-        void playColor(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                       const QString& easing, const QString& direction, bool useAuto);
-        void loadColor(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                       const QString& easing, const QString& direction, bool useAuto);
-        void stopColor(int channel, int videolayer);
-
-        void pauseImage(int channel, int videolayer);
-        void playImage(int channel, int videolayer);
-        void playImage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                       const QString& easing, const QString& direction, bool useAuto);
-        void loadImage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
-                       const QString& easing, const QString& direction, bool useAuto);
-        void stopImage(int channel, int videolayer);
-
-        void startRecording(int channel, const QString& filename, const QString& codec, const QString& preset, const QString& tune, bool withAlpha);
-        void stopRecording(int channel);
-
-        void print(int channel, const QString& output);
-
-        void pauseDeviceInput(int channel, int videolayer);
-        void playDeviceInput(int channel, int videolayer);
-        void playDeviceInput(int channel, int videolayer, int device, const QString& format);
-        void loadDeviceInput(int channel, int videolayer, int device, const QString& format);
-        void stopDeviceInput(int channel, int videolayer);
-
-        void pauseImageScroll(int channel, int videolayer);
-        void playImageScroll(int channel, int videolayer);
-        void playImageScroll(int channel, int videolayer, const QString& name, int blur, int speed, bool premultiply, bool progressive);
-        void loadImageScroll(int channel, int videolayer, const QString& name, int blur, int speed, bool premultiply, bool progressive);
-        void stopImageScroll(int channel, int videolayer);
-
-        void setCommit(int channel);
-        void setChroma(int channel, int videolayer, const QString& key, float threshold, float spread, float spill, float blur, bool mask);
-        void setBlendMode(int channel, int videolayer, const QString& blendMode);
-        void setGrid(int channel, int grid, int duration, const QString& easing, bool defer = false);
-        void setKeyer(int channel, int videolayer, int keyer, bool defer = false);
-        void setVolume(int channel, int videolayer, float volume, bool defer = false);
-        void setVolume(int channel, int videolayer, float volume, int duration, const QString& easing, bool defer = false);
-        void setOpacity(int channel, int videolayer, float opacity, bool defer = false);
-        void setOpacity(int channel, int videolayer, float opacity, int duration, const QString& easing, bool defer = false);
-        void setBrightness(int channel, int videolayer, float brightness, bool defer = false);
-        void setBrightness(int channel, int videolayer, float brightness, int duration, const QString& easing, bool defer = false);
-        void setContrast(int channel, int videolayer, float contrast, bool defer = false);
-        void setContrast(int channel, int videolayer, float contrast, int duration, const QString& easing, bool defer = false);
-        void setSaturation(int channel, int videolayer, float saturation, bool defer = false);
-        void setSaturation(int channel, int videolayer, float saturation, int duration, const QString& easing, bool defer = false);
-        void setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
-                       bool defer = false);
-        void setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
-                       int duration, const QString& easing, bool defer = false);
-        void setGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
-                         bool defer = false);
-        void setGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
-                         int duration, const QString& easing, bool defer = false);
-        void setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
-                         bool defer = false);
-        void setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
-                         int duration, const QString& easing, bool defer = false);
+        int refreshData();
+        int refreshMedia();
+        int refreshTemplate();
+        int refreshChannels();
+        int refreshThumbnail();
+
+        int refreshFlashVersion();
+        int refreshServerVersion();
+        int refreshTemplateHostVersion();
+
+        int retrieveThumbnail(const QString& name);
+
+        int sendCommand(const QString& command);
+
+        int clearChannel(int channel);
+        int clearMixerChannel(int channel);
+        int clearVideolayer(int channel, int videolayer);
+        int clearMixerVideolayer(int channel, int videolayer);
+
+        int setMasterVolume(int channel, float masterVolume);
+
+        int addTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad);
+        int addTemplate(int channel, int videolayer, int flashlayer, const QString& name, bool playOnLoad, const QString& data);
+        int invokeTemplate(int channel, int videolayer, int flashlayer, const QString& label);
+        int nextTemplate(int channel, int videolayer, int flashlayer);
+        int playTemplate(int channel, int videolayer, int flashlayer);
+        int playTemplate(int channel, int videolayer, int flashlayer, const QString& name);
+        int playTemplate(int channel, int videolayer, int flashlayer, const QString& name, const QString& data);
+        int removeTemplate(int channel, int videolayer, int flashlayer);
+        int stopTemplate(int channel, int videolayer, int flashlayer);
+        int updateTemplate(int channel, int videolayer, int flashlayer, const QString& data);
+
+        int pauseVideo(int channel, int videolayer);
+        int playVideo(int channel, int videolayer);
+        int playVideo(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                      const QString& easing, const QString& direction, int seek, int length, bool loop, bool useAuto);
+        int loadVideo(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                      const QString& easing, const QString& direction, int seek, int length, bool loop, bool freezeOnLoad, bool useAuto);
+        int stopVideo(int channel, int videolayer);
+
+        int pauseAudio(int channel, int videolayer);
+        int playAudio(int channel, int videolayer);
+        int playAudio(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                      const QString& easing, const QString& direction, bool loop, bool useAuto);
+        int loadAudio(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                      const QString& easing, const QString& direction, bool loop, bool useAuto);
+        int stopAudio(int channel, int videolayer);
+
+        int pauseColor(int channel, int videolayer);
+        int playColor(int channel, int videolayer);
+        int playColor(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                      const QString& easing, const QString& direction, bool useAuto);
+        int loadColor(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                      const QString& easing, const QString& direction, bool useAuto);
+        int stopColor(int channel, int videolayer);
+
+        int pauseImage(int channel, int videolayer);
+        int playImage(int channel, int videolayer);
+        int playImage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                      const QString& easing, const QString& direction, bool useAuto);
+        int loadImage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                      const QString& easing, const QString& direction, bool useAuto);
+        int stopImage(int channel, int videolayer);
+
+        int startRecording(int channel, const QString& filename, const QString& codec, const QString& preset, const QString& tune, bool withAlpha);
+        int stopRecording(int channel);
+
+        int print(int channel, const QString& output);
+
+        int pauseDeviceInput(int channel, int videolayer);
+        int playDeviceInput(int channel, int videolayer);
+        int playDeviceInput(int channel, int videolayer, int device, const QString& format);
+        int loadDeviceInput(int channel, int videolayer, int device, const QString& format);
+        int stopDeviceInput(int channel, int videolayer);
+
+        int pauseImageScroll(int channel, int videolayer);
+        int playImageScroll(int channel, int videolayer);
+        int playImageScroll(int channel, int videolayer, const QString& name, int blur, int speed, bool premultiply, bool progressive);
+        int loadImageScroll(int channel, int videolayer, const QString& name, int blur, int speed, bool premultiply, bool progressive);
+        int stopImageScroll(int channel, int videolayer);
+
+        int setCommit(int channel);
+        int setChroma(int channel, int videolayer, const QString& key, float threshold, float spread, float spill, float blur, bool mask);
+        int setBlendMode(int channel, int videolayer, const QString& blendMode);
+        int setGrid(int channel, int grid, int duration, const QString& easing, bool defer = false);
+        int setKeyer(int channel, int videolayer, int keyer, bool defer = false);
+        int setVolume(int channel, int videolayer, float volume, bool defer = false);
+        int setVolume(int channel, int videolayer, float volume, int duration, const QString& easing, bool defer = false);
+        int setOpacity(int channel, int videolayer, float opacity, bool defer = false);
+        int setOpacity(int channel, int videolayer, float opacity, int duration, const QString& easing, bool defer = false);
+        int setBrightness(int channel, int videolayer, float brightness, bool defer = false);
+        int setBrightness(int channel, int videolayer, float brightness, int duration, const QString& easing, bool defer = false);
+        int setContrast(int channel, int videolayer, float contrast, bool defer = false);
+        int setContrast(int channel, int videolayer, float contrast, int duration, const QString& easing, bool defer = false);
+        int setSaturation(int channel, int videolayer, float saturation, bool defer = false);
+        int setSaturation(int channel, int videolayer, float saturation, int duration, const QString& easing, bool defer = false);
+        int setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
+                      bool defer = false);
+        int setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
+                      int duration, const QString& easing, bool defer = false);
+        int setGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                        bool defer = false);
+        int setGeometry(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                        int duration, const QString& easing, bool defer = false);
+        int setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                        bool defer = false);
+        int setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
+                        int duration, const QString& easing, bool defer = false);
 
         Q_SIGNAL void connectionStateChanged(CasparDevice&);
+        Q_SIGNAL void ipAddressChanged(CasparDevice&);
         Q_SIGNAL void infoChanged(const QList<QString>&, CasparDevice&);
         Q_SIGNAL void infoSystemChanged(const QList<QString>&, CasparDevice&);
         Q_SIGNAL void mediaChanged(const QList<CasparMedia>&, CasparDevice&);
@@ -136,11 +139,20 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
         Q_SIGNAL void versionChanged(const QString& version, CasparDevice&);
         Q_SIGNAL void responseChanged(const QString&, CasparDevice&);
         Q_SIGNAL void thumbnailChanged(const QList<CasparThumbnail>&, CasparDevice&);
-        Q_SIGNAL void thumbnailRetrieveChanged(const QString& data, CasparDevice&);
+        Q_SIGNAL void thumbnailRetrieveChanged(const QString& data, int ticket, CasparDevice&);
 
     protected:
         void sendNotification();
 
     private:
-        QString convertToTimecode(double time, int fps);
+        Q_SLOT void notifyInfoChanged(const QList<QString>& items);
+        Q_SLOT void notifyInfoSystemChanged(const QList<QString>& items);
+        Q_SLOT void notifyMediaChanged(const QList<CasparMedia>& items);
+        Q_SLOT void notifyTemplateChanged(const QList<CasparTemplate>& items);
+        Q_SLOT void notifyDataChanged(const QList<CasparData>& items);
+        Q_SLOT void notifyVersionChanged(const QString& version);
+        Q_SLOT void notifyResponseChanged(const QString& response);
+        Q_SLOT void notifyThumbnailChanged(const QList<CasparThumbnail>& items);
+        Q_SLOT void notifyThumbnailRetrieveChanged(const QString& data, int ticket);
+        Q_SLOT void notifyHostResolved(const QString& host, const QString& address);
 };
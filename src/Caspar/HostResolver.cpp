@@ -0,0 +1,92 @@
+#include "HostResolver.h"
+
+#include <QtNetwork/QHostAddress>
+
+Q_GLOBAL_STATIC(HostResolver, hostResolver)
+
+HostResolver::HostResolver(QObject* parent)
+    : QObject(parent)
+{
+}
+
+HostResolver& HostResolver::getInstance()
+{
+    return *hostResolver();
+}
+
+QString HostResolver::resolve(const QString& host)
+{
+    if (host == "localhost")
+        return "127.0.0.1";
+
+    QHostAddress address(host);
+    if (!address.isNull())
+        return host; // The ip address is valid.
+
+    HostEntry& entry = this->entries[host];
+    if (entry.lookupId == 0 && (entry.expires.isNull() || entry.expires <= QDateTime::currentDateTimeUtc()))
+        startLookup(host, entry);
+
+    // Until the first lookup has finished this is empty, later on it is the last known address.
+    return entry.address;
+}
+
+void HostResolver::invalidate(const QString& host)
+{
+    if (!this->entries.contains(host))
+        return;
+
+    // Keep the last known address, callers get it until the new lookup has finished.
+    HostEntry& entry = this->entries[host];
+    if (entry.lookupId == 0)
+        startLookup(host, entry);
+}
+
+void HostResolver::startLookup(const QString& host, HostEntry& entry)
+{
+    entry.lookupId = QHostInfo::lookupHost(host, this, SLOT(lookupFinished(const QHostInfo&)));
+    this->lookups.insert(entry.lookupId, host);
+}
+
+void HostResolver::lookupFinished(const QHostInfo& hostInfo)
+{
+    const QString host = this->lookups.take(hostInfo.lookupId());
+    if (host.isEmpty() || !this->entries.contains(host))
+        return;
+
+    // Prefer IPv4, that is what the servers send OSC from.
+    QString address;
+    foreach (const QHostAddress& candidate, hostInfo.addresses())
+    {
+        if (candidate.protocol() == QAbstractSocket::IPv4Protocol)
+        {
+            address = candidate.toString();
+            break;
+        }
+    }
+
+    if (address.isEmpty() && !hostInfo.addresses().isEmpty())
+        address = hostInfo.addresses().at(0).toString();
+
+    HostEntry& entry = this->entries[host];
+    entry.lookupId = 0;
+
+    if (hostInfo.error() != QHostInfo::NoError || address.isEmpty())
+    {
+        entry.expires = QDateTime::currentDateTimeUtc().addSecs(HostResolver::NEGATIVE_TTL);
+        if (entry.address.isEmpty())
+            return; // Nothing changed for the listeners.
+
+        entry.address.clear();
+    }
+    else
+    {
+        entry.expires = QDateTime::currentDateTimeUtc().addSecs(HostResolver::POSITIVE_TTL);
+        if (entry.address == address)
+            return;
+
+        entry.address = address;
+    }
+
+    emit hostResolved(host, entry.address);
+}
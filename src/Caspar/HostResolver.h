@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+#include <QtNetwork/QHostInfo>
+
+// Asynchronous host name cache shared by all devices. resolve() never blocks, it answers from the cache
+// (even when the entry is stale) and starts a lookup in the background, hostResolved() is emitted once
+// the address is known. Failed lookups are cached for a shorter time so a missing host is not retried
+// on every call.
+class CASPAR_EXPORT HostResolver : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit HostResolver(QObject* parent = 0);
+
+        static HostResolver& getInstance();
+
+        QString resolve(const QString& host);
+        void invalidate(const QString& host);
+
+        Q_SIGNAL void hostResolved(const QString& host, const QString& address);
+
+    private:
+        struct HostEntry
+        {
+            HostEntry() : lookupId(0) {}
+
+            QString address;
+            QDateTime expires;
+            int lookupId;
+        };
+
+        static const int POSITIVE_TTL = 300; // Seconds.
+        static const int NEGATIVE_TTL = 30;
+
+        QHash<QString, HostEntry> entries;
+        QHash<int, QString> lookups;
+
+        void startLookup(const QString& host, HostEntry& entry);
+
+        Q_SLOT void lookupFinished(const QHostInfo& hostInfo);
+};
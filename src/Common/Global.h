@@ -44,6 +44,8 @@ namespace Osc
 {
     static const bool DEFAULT_TRIGGER_ON_NEXT = false;
     static const int DEFAULT_PORT = 6250;
+    static const int DEFAULT_BATCH_INTERVAL = 40;
+    static const int DEFAULT_CONTROL_RATE_LIMIT = 50;
     static const QString DEFAULT_OUTPUT = "";
     static const QString DEFAULT_TYPE = "String";
     static const int DEFAULT_OUTPUT_PORT = 7250;
@@ -146,6 +148,7 @@ namespace Color
     static const QString DEFAULT_MIXER_COLOR = "Sienna";
     static const QString DEFAULT_TRICASTER_COLOR = "DarkOliveGreen";
     static const QString DEFAULT_ATEM_COLOR = "DarkOliveGreen";
+    static const QString DEFAULT_THUMBNAIL_COLOR = "DimGray";
     static const QString DEFAULT_PRODUCER_COLOR = "SeaGreen";
     static const QString DEFAULT_TEMPLATE_COLOR = "OliveDrab";
     static const QString DEFAULT_SEPARATOR_COLOR = "Maroon";
@@ -277,6 +280,9 @@ namespace Library
     static const int MOVIE_PAGE_INDEX = 4;
     static const int DATA_PAGE_INDEX = 5;
     static const int PRESET_PAGE_INDEX = 6;
+
+    static const int PAGE_SIZE = 250; // Items added to a list at a time, the next page is added when scrolled to the end.
+    static const int FILTER_DELAY = 150; // Milliseconds after the last key press before the filter is applied.
 }
 
 namespace Print
@@ -1,5 +1,6 @@
 #include "AtemDeviceManager.h"
 #include "DatabaseManager.h"
+#include "ReconnectScheduler.h"
 #include "Events/ConnectionStateChangedEvent.h"
 #include "Models/Atem/AtemDeviceModel.h"
 
@@ -35,7 +36,8 @@ void AtemDeviceManager::initialize()
 
         emit deviceAdded(*device);
 
-        device->connectDevice();
+        QObject::connect(device.data(), SIGNAL(connectionStateChanged(AtemDevice&)), this, SLOT(deviceConnectionStateChanged(AtemDevice&)));
+        ReconnectScheduler::getInstance().addDevice(device.data());
     }
 }
 
@@ -44,6 +46,8 @@ void AtemDeviceManager::uninitialize()
     foreach (const QString& key, this->devices.keys())
     {
         QSharedPointer<AtemDevice>& device = this->devices[key];
+
+        ReconnectScheduler::getInstance().removeDevice(device.data());
         device->disconnectDevice();
     }
 }
@@ -69,6 +73,7 @@ void AtemDeviceManager::refresh()
 
         if (!foundDevice)
         {
+            ReconnectScheduler::getInstance().removeDevice(device.data());
             device->disconnectDevice();
 
             this->devices.remove(key);
@@ -90,7 +95,8 @@ void AtemDeviceManager::refresh()
 
             emit deviceAdded(*device);
 
-            device->connectDevice();
+            QObject::connect(device.data(), SIGNAL(connectionStateChanged(AtemDevice&)), this, SLOT(deviceConnectionStateChanged(AtemDevice&)));
+            ReconnectScheduler::getInstance().addDevice(device.data());
         }
     }
 }
@@ -135,3 +141,8 @@ const QSharedPointer<AtemDevice> AtemDeviceManager::getDeviceByName(const QStrin
 {
     return this->devices.value(name);
 }
+
+void AtemDeviceManager::deviceConnectionStateChanged(AtemDevice& device)
+{
+    ReconnectScheduler::getInstance().setConnected(&device, device.isConnected());
+}
@@ -37,5 +37,7 @@ class CORE_EXPORT AtemDeviceManager : public QObject
     private:
         QMap<QString, AtemDeviceModel> deviceModels;
         QMap<QString, QSharedPointer<AtemDevice> > devices;
+
+        Q_SLOT void deviceConnectionStateChanged(AtemDevice& device);
 };
 
@@ -58,7 +58,9 @@ HEADERS += \
     Commands/BlendModeCommand.h \
     Models/BlendModeModel.h \
     Events/Rundown/SaveRundownEvent.h \
+    LibraryIndex.h \
     LibraryManager.h \
+    LibrarySynchronizer.h \
     Events/Library/RefreshLibraryEvent.h \
     Events/Library/AutoRefreshLibraryEvent.h \
     Events/Rundown/CompactViewEvent.h \
@@ -70,6 +72,7 @@ HEADERS += \
     Commands/ClearOutputCommand.h \
     Animations/ActiveAnimation.h \
     Models/ThumbnailModel.h \
+    ThumbnailCache.h \
     ThumbnailWorker.h \
     Commands/AudioCommand.h \
     Commands/SolidColorCommand.h \
@@ -151,7 +154,10 @@ HEADERS += \
     Models/Atem/AtemAudioInputStateModel.h \
     Commands/Atem/AtemAudioInputStateCommand.h \
     Commands/Atem/AtemAudioInputBalanceCommand.h \
-    Commands/Atem/AtemAudioGainCommand.h
+    Commands/Atem/AtemAudioGainCommand.h \
+    ReconnectScheduler.h \
+    PlaybackStateManager.h \
+    PlaybackStateSubscription.h
 
 SOURCES += \
     DatabaseManager.cpp \
@@ -199,7 +205,9 @@ SOURCES += \
     Models/BlendModeModel.cpp \
     Commands/BlendModeCommand.cpp \
     Events/Rundown/SaveRundownEvent.cpp \
+    LibraryIndex.cpp \
     LibraryManager.cpp \
+    LibrarySynchronizer.cpp \
     Events/Library/AutoRefreshLibraryEvent.cpp \
     Events/Library/RefreshLibraryEvent.cpp \
     Events/Rundown/CompactViewEvent.cpp \
@@ -211,6 +219,7 @@ SOURCES += \
     Commands/AbstractProperties.cpp \
     Animations/ActiveAnimation.cpp \
     Models/ThumbnailModel.cpp \
+    ThumbnailCache.cpp \
     ThumbnailWorker.cpp \
     Commands/AudioCommand.cpp \
     Commands/SolidColorCommand.cpp \
@@ -292,7 +301,10 @@ SOURCES += \
     Models/Atem/AtemAudioInputStateModel.cpp \
     Commands/Atem/AtemAudioInputStateCommand.cpp \
     Commands/Atem/AtemAudioInputBalanceCommand.cpp \
-    Commands/Atem/AtemAudioGainCommand.cpp
+    Commands/Atem/AtemAudioGainCommand.cpp \
+    ReconnectScheduler.cpp \
+    PlaybackStateManager.cpp \
+    PlaybackStateSubscription.cpp
 
 INCLUDEPATH += $$PWD/../../lib/qatemcontrol/include
 win32:CONFIG(release, debug|release):LIBS += -L$$PWD/../../lib/qatemcontrol/lib/win32/release/ -lqatemcontrol
@@ -1,8 +1,12 @@
 #include "DatabaseManager.h"
 
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QStringList>
+#include <QtCore/QThread>
 #include <QtCore/QTime>
 #include <QtCore/QVariant>
 
@@ -16,6 +20,10 @@ DatabaseManager::DatabaseManager()
 {
 }
 
+DatabaseManager::~DatabaseManager()
+{
+}
+
 DatabaseManager& DatabaseManager::getInstance()
 {
     return *databaseManager();
@@ -25,8 +33,14 @@ void DatabaseManager::initialize()
 {
     QMutexLocker locker(&mutex);
 
+    setupConnection(QSqlDatabase::database());
+
     if (QSqlDatabase::database().tables().count() > 0)
+    {
+        upgradeDatabase();
+        removeUnusedThumbnails();
         return;
+    }
 
     // Setup the database.
     QSqlQuery sql;
@@ -105,6 +119,8 @@ void DatabaseManager::initialize()
     sql.exec("INSERT INTO Configuration (Name, Value) VALUES('GpiSerialPort', 'COM1')");
     sql.exec("INSERT INTO Configuration (Name, Value) VALUES('GpiBaudRate', '115200')");
     sql.exec("INSERT INTO Configuration (Name, Value) VALUES('OscPort', '6250')");
+    sql.exec("INSERT INTO Configuration (Name, Value) VALUES('OscBatchInterval', '40')");
+    sql.exec("INSERT INTO Configuration (Name, Value) VALUES('OscControlRateLimit', '50')");
     sql.exec("INSERT INTO Configuration (Name, Value) VALUES('TriCasterPort', '5950')");
     sql.exec("INSERT INTO Configuration (Name, Value) VALUES('DelayType', 'Frames')");
     sql.exec("INSERT INTO Configuration (Name, Value) VALUES('TriCasterProduct', 'TriCaster 8000')");
@@ -399,75 +415,298 @@ void DatabaseManager::initialize()
     sql.exec("INSERT INTO Type (Value) VALUES('MOVIE')");
     sql.exec("INSERT INTO Type (Value) VALUES('STILL')");
     sql.exec("INSERT INTO Type (Value) VALUES('TEMPLATE')");
+
+    upgradeDatabase();
+
+    // Settings read before the tables were created came from an empty database.
+    publishCache(loadCache());
 }
 
 void DatabaseManager::uninitialize()
 {
+    QMutexLocker locker(&mutex);
+
+    // The statements must go before the connections are closed.
+    this->statements.clear();
 }
 
-void DatabaseManager::updateConfiguration(const ConfigurationModel& model)
+void DatabaseManager::setupConnection(QSqlDatabase database)
 {
-    QMutexLocker locker(&mutex);
+    // WAL lets the library refresh write while the GUI reads and needs fewer fsyncs than a rollback
+    // journal, NORMAL is still safe against corruption in WAL mode. The journal mode is stored in
+    // the database, the rest only applies to this connection.
+    QStringList pragmas;
+    pragmas << "PRAGMA journal_mode = WAL"
+            << "PRAGMA synchronous = NORMAL"
+            << QString("PRAGMA cache_size = -%1").arg(DatabaseManager::CACHE_SIZE)
+            << QString("PRAGMA mmap_size = %1").arg(DatabaseManager::MMAP_SIZE)
+            << "PRAGMA temp_store = MEMORY";
 
-    QSqlDatabase::database().transaction();
+    QSqlQuery sql(database);
+    foreach (const QString& pragma, pragmas)
+    {
+        if (!sql.exec(pragma))
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(pragma).arg(sql.lastError().text());
+    }
+}
+
+void DatabaseManager::upgradeDatabase()
+{
+    QSqlQuery sql;
+    if (!sql.exec("PRAGMA user_version"))
+       qCritical() << QString("Failed to execute: PRAGMA user_version, Error: %1").arg(sql.lastError().text());
+
+    sql.first();
+
+    const int version = sql.value(0).toInt();
+    sql.finish();
+
+    if (version < 1)
+    {
+        // Indexes for the library lookups and joins, the name index on Library also covers the
+        // ORDER BY of the library lists and the thumbnail lookup by name.
+        QStringList queries;
+        queries << "CREATE INDEX IF NOT EXISTS IX_Library_DeviceId_TypeId_Name ON Library (DeviceId, TypeId, Name)"
+                << "CREATE INDEX IF NOT EXISTS IX_Library_TypeId_Name ON Library (TypeId, Name, DeviceId)"
+                << "CREATE INDEX IF NOT EXISTS IX_Library_Name ON Library (Name)"
+                << "CREATE INDEX IF NOT EXISTS IX_Library_ThumbnailId ON Library (ThumbnailId)"
+                << "CREATE INDEX IF NOT EXISTS IX_Device_Name ON Device (Name)"
+                << "CREATE INDEX IF NOT EXISTS IX_Device_Address ON Device (Address)"
+                << "PRAGMA user_version = 1";
+
+        QSqlDatabase::database().transaction();
+
+        foreach (const QString& query, queries)
+        {
+            if (!sql.exec(query))
+               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+        }
+
+        QSqlDatabase::database().commit();
+
+        qDebug() << QString("Upgraded the database from version %1 to 1").arg(version);
+    }
+
+    if (version < 2)
+    {
+        // Thumbnails move from base64 TEXT in Thumbnail.Data to PNG BLOBs in ThumbnailImage, content addressed
+        // by their SHA-1 so an image that several servers have is stored once. A Thumbnail row (the timestamp
+        // and size of one library item, which gives the server and name) points at its image.
+        QStringList queries;
+        queries << "CREATE TABLE IF NOT EXISTS ThumbnailImage (Id INTEGER PRIMARY KEY, Hash BLOB UNIQUE, Data BLOB)"
+                << "ALTER TABLE Thumbnail ADD COLUMN ImageId INTEGER"
+                << "CREATE INDEX IF NOT EXISTS IX_Thumbnail_ImageId ON Thumbnail (ImageId)";
+
+        QTime time;
+        time.start();
+
+        QSqlDatabase::database().transaction();
+
+        foreach (const QString& query, queries)
+        {
+            if (!sql.exec(query))
+               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+        }
+
+        // Only the ids are read up front, the data of one thumbnail at a time.
+        QList<int> ids;
+        if (!sql.exec("SELECT Id FROM Thumbnail WHERE Data IS NOT NULL"))
+           qCritical() << QString("Failed to execute: SELECT Id FROM Thumbnail, Error: %1").arg(sql.lastError().text());
+
+        while (sql.next())
+            ids.push_back(sql.value(0).toInt());
+
+        sql.finish();
+
+        QString selectQuery("SELECT Data FROM Thumbnail WHERE Id = ?");
+        QString updateQuery("UPDATE Thumbnail SET ImageId = ?, Data = NULL WHERE Id = ?");
+
+        foreach (int id, ids)
+        {
+            QSqlQuery& selectSql = prepareQuery(selectQuery);
+            selectSql.addBindValue(id);
+            if (!selectSql.exec())
+               qCritical() << QString("Failed to execute: %1, Error: %2").arg(selectQuery).arg(selectSql.lastError().text());
+
+            selectSql.first();
+
+            const QByteArray data = QByteArray::fromBase64(selectSql.value(0).toString().toAscii());
+            selectSql.finish();
 
-    QString query = QString("UPDATE Configuration SET Value = '%1' "
-                            "WHERE Name = '%2'").arg(model.getValue()).arg(model.getName());
+            QSqlQuery& updateSql = prepareQuery(updateQuery);
+            updateSql.addBindValue(insertThumbnailImage(data));
+            updateSql.addBindValue(id);
+            if (!updateSql.exec())
+               qCritical() << QString("Failed to execute: %1, Error: %2").arg(updateQuery).arg(updateSql.lastError().text());
+        }
+
+        if (!sql.exec("PRAGMA user_version = 2"))
+           qCritical() << QString("Failed to execute: PRAGMA user_version = 2, Error: %1").arg(sql.lastError().text());
+
+        QSqlDatabase::database().commit();
+
+        // Give the space of the base64 text back, only possible outside a transaction.
+        if (ids.count() > 0 && !sql.exec("VACUUM"))
+           qCritical() << QString("Failed to execute: VACUUM, Error: %1").arg(sql.lastError().text());
+
+        qDebug() << QString("Upgraded the database from version %1 to 2, moved %2 thumbnails in %3 msec").arg(version).arg(ids.count()).arg(time.elapsed());
+    }
+}
+
+void DatabaseManager::removeUnusedThumbnails()
+{
+    // Deleted media leave their thumbnails behind, and thumbnails that were replaced or deleted their images.
+    QStringList queries;
+    queries << "DELETE FROM Thumbnail WHERE Id NOT IN (SELECT ThumbnailId FROM Library WHERE ThumbnailId IS NOT NULL)"
+            << "DELETE FROM ThumbnailImage WHERE Id NOT IN (SELECT ImageId FROM Thumbnail WHERE ImageId IS NOT NULL)";
+
+    QSqlDatabase::database().transaction();
 
     QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    foreach (const QString& query, queries)
+    {
+        if (!sql.exec(query))
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    }
 
     QSqlDatabase::database().commit();
 }
 
-ConfigurationModel DatabaseManager::getConfigurationByName(const QString& name)
+int DatabaseManager::insertThumbnailImage(const QByteArray& data)
 {
-    QMutexLocker locker(&mutex);
+    const QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
 
-    QString query = QString("SELECT c.Id, c.Name, c.Value FROM Configuration c "
-                            "WHERE c.Name = '%1'").arg(name);
+    QString insertQuery("INSERT OR IGNORE INTO ThumbnailImage (Hash, Data) VALUES(?, ?)");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& insertSql = prepareQuery(insertQuery);
+    insertSql.addBindValue(hash);
+    insertSql.addBindValue(data);
+    if (!insertSql.exec())
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(insertQuery).arg(insertSql.lastError().text());
+
+    // The image may already have been there, look the id up by hash either way.
+    QString selectQuery("SELECT Id FROM ThumbnailImage WHERE Hash = ?");
+
+    QSqlQuery& selectSql = prepareQuery(selectQuery);
+    selectSql.addBindValue(hash);
+    if (!selectSql.exec())
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(selectQuery).arg(selectSql.lastError().text());
+
+    selectSql.first();
+
+    const int id = selectSql.value(0).toInt();
+    selectSql.finish();
+
+    return id;
+}
+
+void DatabaseManager::removeThumbnailImage(int id)
+{
+    QString query("DELETE FROM ThumbnailImage WHERE Id = ? AND NOT EXISTS (SELECT 1 FROM Thumbnail WHERE ImageId = ?)");
+
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(id);
+    sql.addBindValue(id);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+}
 
-    sql.first();
+QSqlDatabase DatabaseManager::getDatabase()
+{
+    // A connection may only be used by the thread that opened it. The GUI thread uses the default
+    // connection, any other thread gets its own connection to the same file the first time it asks.
+    QThread* thread = QThread::currentThread();
+    if (QCoreApplication::instance() == NULL || thread == QCoreApplication::instance()->thread())
+        return QSqlDatabase::database();
+
+    const QString name = QString("%1-%2").arg(thread->objectName()).arg(reinterpret_cast<quintptr>(thread));
+    if (!QSqlDatabase::contains(name))
+    {
+        QSqlDatabase database = QSqlDatabase::cloneDatabase(QSqlDatabase::database(), name);
+        if (!database.open())
+           qCritical() << QString("Failed to open the connection: %1, Error: %2").arg(name).arg(database.lastError().text());
+
+        setupConnection(database);
+    }
 
-    return ConfigurationModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString());
+    return QSqlDatabase::database(name);
 }
 
-QList<FormatModel> DatabaseManager::getFormat()
+QSqlQuery& DatabaseManager::prepareQuery(const QString& query)
+{
+    QSqlDatabase database = getDatabase();
+
+    QHash<QString, QSqlQuery>& statements = this->statements[database.connectionName()];
+    QHash<QString, QSqlQuery>::iterator statement = statements.find(query);
+    if (statement == statements.end())
+    {
+        QSqlQuery sql(database);
+        sql.setForwardOnly(true);
+        if (!sql.prepare(query))
+           qCritical() << QString("Failed to prepare: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+        statement = statements.insert(query, sql);
+    }
+
+    return statement.value();
+}
+
+void DatabaseManager::updateConfiguration(const ConfigurationModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT f.Id, f.Name, f.Width, f.Height, f.FramesPerSecond FROM Format f");
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QString query("UPDATE Configuration SET Value = ? "
+                  "WHERE Name = ?");
+
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getValue());
+    sql.addBindValue(model.getName());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QList<FormatModel> models;
-    while (sql.next())
-        models.push_back(FormatModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toInt(), sql.value(3).toInt(), sql.value(4).toString()));
+    database.commit();
 
-    return models;
+    DatabaseCache* cache = new DatabaseCache(*getCache());
+
+    QHash<QString, int>::const_iterator index = cache->configurationIndex.constFind(model.getName());
+    if (index != cache->configurationIndex.constEnd())
+        cache->configurations[index.value()] = ConfigurationModel(cache->configurations.at(index.value()).getId(), model.getName(), model.getValue());
+
+    publishCache(cache);
+
+    locker.unlock();
+
+    emit configurationChanged(model.getName());
 }
 
-FormatModel DatabaseManager::getFormat(const QString& name)
+ConfigurationModel DatabaseManager::getConfigurationByName(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    const QSharedPointer<const DatabaseCache> cache = getCache();
 
-    QString query = QString("SELECT f.Id, f.Name, f.Width, f.Height, f.FramesPerSecond FROM Format f "
-                            "WHERE f.Name = '%1'").arg(name);
+    QHash<QString, int>::const_iterator index = cache->configurationIndex.constFind(name);
+    if (index == cache->configurationIndex.constEnd())
+        return ConfigurationModel(0, QString(), QString());
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    return cache->configurations.at(index.value());
+}
 
-    sql.first();
+QList<FormatModel> DatabaseManager::getFormat()
+{
+    return getCache()->formats;
+}
+
+FormatModel DatabaseManager::getFormat(const QString& name)
+{
+    const QSharedPointer<const DatabaseCache> cache = getCache();
+
+    QHash<QString, int>::const_iterator index = cache->formatIndex.constFind(name);
+    if (index == cache->formatIndex.constEnd())
+        return FormatModel(0, QString(), 0, 0, QString());
 
-    return FormatModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toInt(), sql.value(3).toInt(), sql.value(4).toString());
+    return cache->formats.at(index.value());
 }
 
 QList<PresetModel> DatabaseManager::getPreset()
@@ -491,34 +730,42 @@ PresetModel DatabaseManager::getPreset(const QString& name)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT p.Id, p.Name, p.Value FROM Preset p "
-                            "WHERE p.Name = '%1'").arg(name);
+    QString query("SELECT p.Id, p.Name, p.Value FROM Preset p "
+                  "WHERE p.Name = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(name);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return PresetModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString());
+    const PresetModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString());
+    sql.finish();
+
+    return model;
 }
 
 QList<PresetModel> DatabaseManager::getPresetByFilter(const QString& filter)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT p.Id, p.Name, p.Value "
-                            "WHERE p.Name LIKE '%%1%' OR p.Value LIKE '%%1%' "
-                            "ORDER BY p.Name, p.Id").arg(filter);
+    QString query("SELECT p.Id, p.Name, p.Value FROM Preset p "
+                  "WHERE p.Name LIKE ? OR p.Value LIKE ? "
+                  "ORDER BY p.Name, p.Id");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(filter));
+    sql.addBindValue(QString("%%1%").arg(filter));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<PresetModel> models;
     while (sql.next())
         models.push_back(PresetModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -526,116 +773,61 @@ void DatabaseManager::insertPreset(const PresetModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("INSERT INTO Preset (Name, Value) "
-                            "VALUES('%1', '%2')").arg(model.getName()).arg(model.getValue());
+    QString query("INSERT INTO Preset (Name, Value) "
+                  "VALUES(?, ?)");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getValue());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::deletePreset(int id)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("DELETE FROM Preset WHERE Id = %1").arg(id);
+    QString query("DELETE FROM Preset WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(id);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 QList<BlendModeModel> DatabaseManager::getBlendMode()
 {
-    QMutexLocker locker(&mutex);
-
-    QString query("SELECT b.Id, b.Value FROM BlendMode b");
-
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    QList<BlendModeModel> models;
-    while (sql.next())
-        models.push_back(BlendModeModel(sql.value(0).toInt(), sql.value(1).toString()));
-
-    return models;
+    return getCache()->blendModes;
 }
 
 QList<ChromaModel> DatabaseManager::getChroma()
 {
-    QMutexLocker locker(&mutex);
-
-    QString query("SELECT c.Id, c.Key FROM Chroma c");
-
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    QList<ChromaModel> models;
-    while (sql.next())
-        models.push_back(ChromaModel(sql.value(0).toInt(), sql.value(1).toString()));
-
-    return models;
+    return getCache()->chromas;
 }
 
 QList<DirectionModel> DatabaseManager::getDirection()
 {
-    QMutexLocker locker(&mutex);
-
-    QString query("SELECT d.Id, d.Value FROM Direction d");
-
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    QList<DirectionModel> models;
-    while (sql.next())
-        models.push_back(DirectionModel(sql.value(0).toInt(), sql.value(1).toString()));
-
-    return models;
+    return getCache()->directions;
 }
 
 QList<TransitionModel> DatabaseManager::getTransition()
 {
-    QMutexLocker locker(&mutex);
-
-    QString query("SELECT t.Id, t.Value FROM Transition t");
-
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    QList<TransitionModel> models;
-    while (sql.next())
-        models.push_back(TransitionModel(sql.value(0).toInt(), sql.value(1).toString()));
-
-    return models;
+    return getCache()->transitions;
 }
 
 QList<TweenModel> DatabaseManager::getTween()
 {
-    QMutexLocker locker(&mutex);
-
-    QString query("SELECT t.Id, t.Value FROM Tween t");
-
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    QList<TweenModel> models;
-    while (sql.next())
-        models.push_back(TweenModel(sql.value(0).toInt(), sql.value(1).toString()));
-
-    return models;
+    return getCache()->tweens;
 }
 
 QList<OscOutputModel> DatabaseManager::getOscOutput()
@@ -659,82 +851,101 @@ void DatabaseManager::insertOscOutput(const OscOutputModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("INSERT INTO OscOutput (Name, Address, Port, Description) "
-                            "VALUES('%1', '%2', %3, '%4')")
-                            .arg(model.getName()).arg(model.getAddress()).arg(model.getPort()).arg(model.getDescription());
+    QString query("INSERT INTO OscOutput (Name, Address, Port, Description) "
+                  "VALUES(?, ?, ?, ?)");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getAddress());
+    sql.addBindValue(model.getPort());
+    sql.addBindValue(model.getDescription());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 OscOutputModel DatabaseManager::getOscOutputByName(const QString& name)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT o.Id, o.Name, o.Address, o.Port, o.Description FROM OscOutput o "
-                            "WHERE o.Name = '%1'").arg(name);
+    QString query("SELECT o.Id, o.Name, o.Address, o.Port, o.Description FROM OscOutput o "
+                  "WHERE o.Name = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(name);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return OscOutputModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
-                          sql.value(3).toInt(), sql.value(4).toString());
+    const OscOutputModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
+                               sql.value(3).toInt(), sql.value(4).toString());
+    sql.finish();
+
+    return model;
 }
 
 OscOutputModel DatabaseManager::getOscOutputByAddress(const QString& address)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT o.Id, o.Name, o.Address, o.Port, o.Description FROM OscOutput o "
-                            "WHERE o.Address = '%1'").arg(address);
+    QString query("SELECT o.Id, o.Name, o.Address, o.Port, o.Description FROM OscOutput o "
+                  "WHERE o.Address = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(address);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return OscOutputModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
-                          sql.value(3).toInt(), sql.value(4).toString());
+    const OscOutputModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
+                               sql.value(3).toInt(), sql.value(4).toString());
+    sql.finish();
+
+    return model;
 }
 
 void DatabaseManager::updateOscOutput(const OscOutputModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("UPDATE OscOutput SET Name = '%1', Address = '%2', Port = %3, Description = '%4' WHERE Id = %5")
-                            .arg(model.getName()).arg(model.getAddress()).arg(model.getPort()).arg(model.getDescription()).arg(model.getId());
+    QString query("UPDATE OscOutput SET Name = ?, Address = ?, Port = ?, Description = ? WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getAddress());
+    sql.addBindValue(model.getPort());
+    sql.addBindValue(model.getDescription());
+    sql.addBindValue(model.getId());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::deleteOscOutput(int id)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("DELETE FROM OscOutput WHERE Id = %1").arg(id);
+    QString query("DELETE FROM OscOutput WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(id);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 QList<AtemStepModel> DatabaseManager::getAtemStep()
@@ -893,80 +1104,97 @@ AtemDeviceModel DatabaseManager::getAtemDeviceByName(const QString& name)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT d.Id, d.Name, d.Address, d.Description FROM AtemDevice d "
-                            "WHERE d.Name = '%1'").arg(name);
+    QString query("SELECT d.Id, d.Name, d.Address, d.Description FROM AtemDevice d "
+                  "WHERE d.Name = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(name);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return AtemDeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString());
+    const AtemDeviceModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString());
+    sql.finish();
+
+    return model;
 }
 
 AtemDeviceModel DatabaseManager::getAtemDeviceByAddress(const QString& address)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT d.Id, d.Name, d.Address, d.Description FROM AtemDevice d "
-                            "WHERE d.Address = '%1'").arg(address);
+    QString query("SELECT d.Id, d.Name, d.Address, d.Description FROM AtemDevice d "
+                  "WHERE d.Address = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(address);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return AtemDeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString());
+    const AtemDeviceModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString());
+    sql.finish();
+
+    return model;
 }
 
 void DatabaseManager::insertAtemDevice(const AtemDeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("INSERT INTO AtemDevice (Name, Address, Description) "
-                            "VALUES('%1', '%2', '%3')")
-                            .arg(model.getName()).arg(model.getAddress()).arg(model.getDescription());
+    QString query("INSERT INTO AtemDevice (Name, Address, Description) "
+                  "VALUES(?, ?, ?)");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getAddress());
+    sql.addBindValue(model.getDescription());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::updateAtemDevice(const AtemDeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("UPDATE AtemDevice SET Name = '%1', Address = '%2', Description = '%3' WHERE Id = %4")
-                            .arg(model.getName()).arg(model.getAddress()).arg(model.getDescription()).arg(model.getId());
+    QString query("UPDATE AtemDevice SET Name = ?, Address = ?, Description = ? WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getAddress());
+    sql.addBindValue(model.getDescription());
+    sql.addBindValue(model.getId());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::deleteAtemDevice(int id)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("DELETE FROM AtemDevice WHERE Id = %1").arg(id);
+    QString query("DELETE FROM AtemDevice WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(id);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 QList<TriCasterProductModel> DatabaseManager::getTriCasterProduct()
@@ -991,17 +1219,20 @@ QList<TriCasterInputModel> DatabaseManager::getTriCasterInput()
     QMutexLocker locker(&mutex);
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
-    QString query = QString("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterInput t "
-                            "WHERE t.Products LIKE '%%1%'").arg(product);
+    QString query("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterInput t "
+                  "WHERE t.Products LIKE ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(product));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<TriCasterInputModel> models;
     while (sql.next())
         models.push_back(TriCasterInputModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1010,17 +1241,20 @@ QList<TriCasterStepModel> DatabaseManager::getTriCasterStep()
     QMutexLocker locker(&mutex);
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
-    QString query = QString("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterStep t "
-                            "WHERE t.Products LIKE '%%1%'").arg(product);
+    QString query("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterStep t "
+                  "WHERE t.Products LIKE ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(product));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<TriCasterStepModel> models;
     while (sql.next())
         models.push_back(TriCasterStepModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1029,17 +1263,20 @@ QList<TriCasterAutoSpeedModel> DatabaseManager::getTriCasterAutoSpeed()
     QMutexLocker locker(&mutex);
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
-    QString query = QString("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterAutoSpeed t "
-                            "WHERE t.Products LIKE '%%1%'").arg(product);
+    QString query("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterAutoSpeed t "
+                  "WHERE t.Products LIKE ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(product));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<TriCasterAutoSpeedModel> models;
     while (sql.next())
         models.push_back(TriCasterAutoSpeedModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1048,17 +1285,20 @@ QList<TriCasterAutoTransitionModel> DatabaseManager::getTriCasterAutoTransition(
     QMutexLocker locker(&mutex);
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
-    QString query = QString("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterAutoTransition t "
-                            "WHERE t.Products LIKE '%%1%'").arg(product);
+    QString query("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterAutoTransition t "
+                  "WHERE t.Products LIKE ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(product));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<TriCasterAutoTransitionModel> models;
     while (sql.next())
         models.push_back(TriCasterAutoTransitionModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1067,17 +1307,20 @@ QList<TriCasterPresetModel> DatabaseManager::getTriCasterPreset()
     QMutexLocker locker(&mutex);
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
-    QString query = QString("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterPreset t "
-                            "WHERE t.Products LIKE '%%1%'").arg(product);
+    QString query("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterPreset t "
+                  "WHERE t.Products LIKE ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(product));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<TriCasterPresetModel> models;
     while (sql.next())
         models.push_back(TriCasterPresetModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1086,17 +1329,20 @@ QList<TriCasterSourceModel> DatabaseManager::getTriCasterSource()
     QMutexLocker locker(&mutex);
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
-    QString query = QString("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterSource t "
-                            "WHERE t.Products LIKE '%%1%'").arg(product);
+    QString query("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterSource t "
+                  "WHERE t.Products LIKE ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(product));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<TriCasterSourceModel> models;
     while (sql.next())
         models.push_back(TriCasterSourceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1105,17 +1351,20 @@ QList<TriCasterSwitcherModel> DatabaseManager::getTriCasterSwitcher()
     QMutexLocker locker(&mutex);
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
-    QString query = QString("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterSwitcher t "
-                            "WHERE t.Products LIKE '%%1%'").arg(product);
+    QString query("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterSwitcher t "
+                  "WHERE t.Products LIKE ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(product));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<TriCasterSwitcherModel> models;
     while (sql.next())
         models.push_back(TriCasterSwitcherModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1124,17 +1373,20 @@ QList<TriCasterNetworkTargetModel> DatabaseManager::getTriCasterNetworkTarget()
     QMutexLocker locker(&mutex);
 
     QString product = getConfigurationByName("TriCasterProduct").getValue();
-    QString query = QString("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterNetworkTarget t "
-                            "WHERE t.Products LIKE '%%1%'").arg(product);
+    QString query("SELECT t.Id, t.Name, t.Value, t.Products FROM TriCasterNetworkTarget t "
+                  "WHERE t.Products LIKE ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(QString("%%1%").arg(product));
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<TriCasterNetworkTargetModel> models;
     while (sql.next())
         models.push_back(TriCasterNetworkTargetModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1161,82 +1413,101 @@ TriCasterDeviceModel DatabaseManager::getTriCasterDeviceByName(const QString& na
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT d.Id, d.Name, d.Address, d.Port, d.Description FROM TriCasterDevice d "
-                            "WHERE d.Name = '%1'").arg(name);
+    QString query("SELECT d.Id, d.Name, d.Address, d.Port, d.Description FROM TriCasterDevice d "
+                  "WHERE d.Name = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(name);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return TriCasterDeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
-                                sql.value(3).toInt(), sql.value(4).toString());
+    const TriCasterDeviceModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
+                                     sql.value(3).toInt(), sql.value(4).toString());
+    sql.finish();
+
+    return model;
 }
 
 TriCasterDeviceModel DatabaseManager::getTriCasterDeviceByAddress(const QString& address)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT d.Id, d.Name, d.Address, d.Port, d.Description FROM TriCasterDevice d "
-                            "WHERE d.Address = '%1'").arg(address);
+    QString query("SELECT d.Id, d.Name, d.Address, d.Port, d.Description FROM TriCasterDevice d "
+                  "WHERE d.Address = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(address);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return TriCasterDeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
-                                sql.value(3).toInt(), sql.value(4).toString());
+    const TriCasterDeviceModel model(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
+                                     sql.value(3).toInt(), sql.value(4).toString());
+    sql.finish();
+
+    return model;
 }
 
 void DatabaseManager::insertTriCasterDevice(const TriCasterDeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("INSERT INTO TriCasterDevice (Name, Address, Port, Description) "
-                            "VALUES('%1', '%2', %3, '%4')")
-                            .arg(model.getName()).arg(model.getAddress()).arg(model.getPort()).arg(model.getDescription());
+    QString query("INSERT INTO TriCasterDevice (Name, Address, Port, Description) "
+                  "VALUES(?, ?, ?, ?)");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getAddress());
+    sql.addBindValue(model.getPort());
+    sql.addBindValue(model.getDescription());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::updateTriCasterDevice(const TriCasterDeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("UPDATE TriCasterDevice SET Name = '%1', Address = '%2', Port = %3, Description = '%4' WHERE Id = %5")
-                            .arg(model.getName()).arg(model.getAddress()).arg(model.getPort()).arg(model.getDescription()).arg(model.getId());
+    QString query("UPDATE TriCasterDevice SET Name = ?, Address = ?, Port = ?, Description = ? WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getAddress());
+    sql.addBindValue(model.getPort());
+    sql.addBindValue(model.getDescription());
+    sql.addBindValue(model.getId());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::deleteTriCasterDevice(int id)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("DELETE FROM TriCasterDevice WHERE Id = %1").arg(id);
+    QString query("DELETE FROM TriCasterDevice WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(id);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 QList<GpiPortModel> DatabaseManager::getGpiPorts()
@@ -1260,16 +1531,20 @@ void DatabaseManager::updateGpiPort(const GpiPortModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("UPDATE GpiPort SET Action = '%1', RisingEdge = %2 "
-                            "WHERE Id = %3").arg(Playout::toString(model.getAction())).arg(model.isRisingEdge() ? "1" : "0").arg(model.getPort());
+    QString query("UPDATE GpiPort SET Action = ?, RisingEdge = ? "
+                  "WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(Playout::toString(model.getAction()));
+    sql.addBindValue(model.isRisingEdge() ? 1 : 0);
+    sql.addBindValue(model.getPort());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 QList<GpoPortModel> DatabaseManager::getGpoPorts()
@@ -1294,211 +1569,248 @@ void DatabaseManager::updateGpoPort(const GpoPortModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("UPDATE GpoPort SET PulseLengthMillis = %1, RisingEdge = %2 "
-                            "WHERE Id = %3").arg(model.getPulseLengthMillis()).arg(model.isRisingEdge() ? "1" : "0").arg(model.getPort());
+    QString query("UPDATE GpoPort SET PulseLengthMillis = ?, RisingEdge = ? "
+                  "WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getPulseLengthMillis());
+    sql.addBindValue(model.isRisingEdge() ? 1 : 0);
+    sql.addBindValue(model.getPort());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 QList<TypeModel> DatabaseManager::getType()
 {
-    QMutexLocker locker(&mutex);
-
-    QString query("SELECT t.Id, t.Value FROM Type t");
-
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    QList<TypeModel> models;
-    while (sql.next())
-        models.push_back(TypeModel(sql.value(0).toInt(), sql.value(1).toString()));
-
-    return models;
+    return getCache()->types;
 }
 
 TypeModel DatabaseManager::getTypeByValue(const QString& value)
 {
-    QMutexLocker locker(&mutex);
+    const QSharedPointer<const DatabaseCache> cache = getCache();
 
-    QString query = QString("SELECT t.Id FROM Type t "
-                            "WHERE t.Value = '%1'").arg(value);
+    QHash<QString, int>::const_iterator index = cache->typeIndex.constFind(value);
+    if (index == cache->typeIndex.constEnd())
+        return TypeModel(0, QString());
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    sql.first();
-
-    return TypeModel(sql.value(0).toInt(), sql.value(1).toString());
+    return cache->types.at(index.value());
 }
 
 QList<DeviceModel> DatabaseManager::getDevice()
 {
-    QString query("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats FROM Device d "
-                  "ORDER BY d.Name");
-
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    QList<DeviceModel> models;
-    while (sql.next())
-        models.push_back(DeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toInt(),
-                                     sql.value(4).toString(), sql.value(5).toString(), sql.value(6).toString(), sql.value(7).toString(),
-                                     sql.value(8).toString(), sql.value(9).toInt(), sql.value(10).toString()));
-
-    return models;
+    return getCache()->devices;
 }
 
 DeviceModel DatabaseManager::getDeviceByName(const QString& name)
 {
-    QMutexLocker locker(&mutex);
+    const QSharedPointer<const DatabaseCache> cache = getCache();
 
-    QString query = QString("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats FROM Device d "
-                            "WHERE d.Name = '%1'").arg(name);
-
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    sql.first();
+    QHash<QString, int>::const_iterator index = cache->deviceNameIndex.constFind(name);
+    if (index == cache->deviceNameIndex.constEnd())
+        return DeviceModel(0, QString(), QString(), 0, QString(), QString(), QString(), QString(), QString(), 0, QString());
 
-    return DeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toInt(),
-                       sql.value(4).toString(), sql.value(5).toString(), sql.value(6).toString(), sql.value(6).toString(),
-                       sql.value(8).toString(), sql.value(9).toInt(), sql.value(10).toString());
+    return cache->devices.at(index.value());
 }
 
 DeviceModel DatabaseManager::getDeviceByAddress(const QString& address)
 {
-    QMutexLocker locker(&mutex);
-
-    QString query = QString("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats FROM Device d "
-                            "WHERE d.Address = '%1'").arg(address);
+    const QSharedPointer<const DatabaseCache> cache = getCache();
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-    sql.first();
+    QHash<QString, int>::const_iterator index = cache->deviceAddressIndex.constFind(address);
+    if (index == cache->deviceAddressIndex.constEnd())
+        return DeviceModel(0, QString(), QString(), 0, QString(), QString(), QString(), QString(), QString(), 0, QString());
 
-    return DeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toInt(),
-                       sql.value(4).toString(), sql.value(5).toString(), sql.value(6).toString(), sql.value(6).toString(),
-                       sql.value(8).toString(), sql.value(9).toInt(), sql.value(10).toString());
+    return cache->devices.at(index.value());
 }
 
 void DatabaseManager::insertDevice(const DeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("INSERT INTO Device (Name, Address, Port, Username, Password, Description, Version, Shadow, Channels, ChannelFormats) "
-                            "VALUES('%1', '%2', %3, '%4', '%5', '%6', '%7', '%8', %9, '%10')")
-                            .arg(model.getName()).arg(model.getAddress()).arg(model.getPort()).arg(model.getUsername())
-                            .arg(model.getPassword()).arg(model.getDescription()).arg(model.getVersion()).arg(model.getShadow())
-                            .arg(model.getChannels()).arg(model.getChannelFormats());
+    QString query("INSERT INTO Device (Name, Address, Port, Username, Password, Description, Version, Shadow, Channels, ChannelFormats) "
+                  "VALUES(?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getAddress());
+    sql.addBindValue(model.getPort());
+    sql.addBindValue(model.getUsername());
+    sql.addBindValue(model.getPassword());
+    sql.addBindValue(model.getDescription());
+    sql.addBindValue(model.getVersion());
+    sql.addBindValue(model.getShadow());
+    sql.addBindValue(model.getChannels());
+    sql.addBindValue(model.getChannelFormats());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
+
+    if (!reloadDevice())
+        return;
+
+    locker.unlock();
+
+    emit deviceChanged();
 }
 
 void DatabaseManager::updateDevice(const DeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("UPDATE Device SET Name = '%1', Address = '%2', Port = %3, Username = '%4', Password = '%5', Description = '%6', Shadow = '%7' WHERE Id = %8")
-                            .arg(model.getName()).arg(model.getAddress()).arg(model.getPort()).arg(model.getUsername()).arg(model.getPassword()).arg(model.getDescription()).arg(model.getShadow()).arg(model.getId());
+    QString query("UPDATE Device SET Name = ?, Address = ?, Port = ?, Username = ?, Password = ?, Description = ?, Shadow = ? WHERE Id = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getName());
+    sql.addBindValue(model.getAddress());
+    sql.addBindValue(model.getPort());
+    sql.addBindValue(model.getUsername());
+    sql.addBindValue(model.getPassword());
+    sql.addBindValue(model.getDescription());
+    sql.addBindValue(model.getShadow());
+    sql.addBindValue(model.getId());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
+
+    if (!reloadDevice())
+        return;
+
+    locker.unlock();
+
+    emit deviceChanged();
 }
 
 void DatabaseManager::updateDeviceVersion(const DeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    // Written on every library refresh, nearly always with the value that is already stored.
+    if (getDeviceByAddress(model.getAddress()).getVersion() == model.getVersion())
+        return;
 
-    QString query = QString("UPDATE Device SET Version = '%1' "
-                            "WHERE Address = '%2'").arg(model.getVersion()).arg(model.getAddress());
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QString query("UPDATE Device SET Version = ? "
+                  "WHERE Address = ?");
+
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getVersion());
+    sql.addBindValue(model.getAddress());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
+
+    if (!reloadDevice())
+        return;
+
+    locker.unlock();
+
+    emit deviceChanged();
 }
 
 void DatabaseManager::updateDeviceChannels(const DeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    // Written on every library refresh, nearly always with the value that is already stored.
+    if (getDeviceByAddress(model.getAddress()).getChannels() == model.getChannels())
+        return;
 
-    QString query = QString("UPDATE Device SET Channels = %1 "
-                            "WHERE Address = '%2'").arg(model.getChannels()).arg(model.getAddress());
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QString query("UPDATE Device SET Channels = ? "
+                  "WHERE Address = ?");
+
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getChannels());
+    sql.addBindValue(model.getAddress());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
+
+    if (!reloadDevice())
+        return;
+
+    locker.unlock();
+
+    emit deviceChanged();
 }
 
 void DatabaseManager::updateDeviceChannelFormats(const DeviceModel& model)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    // Written on every library refresh, nearly always with the value that is already stored.
+    if (getDeviceByAddress(model.getAddress()).getChannelFormats() == model.getChannelFormats())
+        return;
 
-    QString query = QString("UPDATE Device SET ChannelFormats = '%1' "
-                            "WHERE Address = '%2'").arg(model.getChannelFormats()).arg(model.getAddress());
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QString query("UPDATE Device SET ChannelFormats = ? "
+                  "WHERE Address = ?");
+
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(model.getChannelFormats());
+    sql.addBindValue(model.getAddress());
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
+
+    if (!reloadDevice())
+        return;
+
+    locker.unlock();
+
+    emit deviceChanged();
 }
 
 void DatabaseManager::deleteDevice(int id)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
-
-    QString query = QString("DELETE FROM Device WHERE Id = %1").arg(id);
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    QStringList queries;
+    queries << "DELETE FROM Device WHERE Id = ?"
+            << "DELETE FROM Thumbnail WHERE Id IN (SELECT l.ThumbnailId FROM Library l WHERE DeviceId = ?)"
+            << "DELETE FROM Library WHERE DeviceId = ?";
 
-    query = QString("DELETE FROM Thumbnail WHERE Id IN (SELECT l.ThumbnailId FROM Library l WHERE DeviceId = %1)").arg(id);
+    foreach (const QString& query, queries)
+    {
+        QSqlQuery& sql = prepareQuery(query);
+        sql.addBindValue(id);
+        if (!sql.exec())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    }
 
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    database.commit();
 
-    query = QString("DELETE FROM Library WHERE DeviceId = %1").arg(id);
+    if (!reloadDevice())
+        return;
 
-    if (!sql.exec(query))
-       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    locker.unlock();
 
-    QSqlDatabase::database().commit();
+    emit deviceChanged();
 }
 
 QList<LibraryModel> DatabaseManager::getLibraryMedia()
@@ -1509,8 +1821,8 @@ QList<LibraryModel> DatabaseManager::getLibraryMedia()
                   "WHERE  l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) "
                   "ORDER BY l.Name, l.DeviceId");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1519,6 +1831,8 @@ QList<LibraryModel> DatabaseManager::getLibraryMedia()
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1530,8 +1844,8 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplate()
                   "WHERE  l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 "
                   "ORDER BY l.Name, l.DeviceId");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1540,6 +1854,8 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplate()
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1551,8 +1867,8 @@ QList<LibraryModel> DatabaseManager::getLibraryData()
                   "WHERE  l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 "
                   "ORDER BY l.Name, l.DeviceId");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1561,6 +1877,8 @@ QList<LibraryModel> DatabaseManager::getLibraryData()
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1569,30 +1887,37 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByFilter(const QString& filt
     QMutexLocker locker(&mutex);
 
     QString query;
+    QList<QString> addresses;
 
     if (!filter.isEmpty() && devices.isEmpty()) // Filter on all devices.
     {
         query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND l.Name LIKE '%%1%' "
-                        "ORDER BY l.Name, l.DeviceId").arg(filter);
+                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND l.Name LIKE ? "
+                        "ORDER BY l.Name, l.DeviceId");
     }
     else if (!filter.isEmpty() && !devices.isEmpty()) // Filter specific devices.
     {
         QString address;
         foreach (QString device, devices)
-            address += QString("d.Address LIKE '%%1%' OR ").arg(device);
+        {
+            address += "d.Address LIKE ? OR ";
+            addresses.append(QString("%%1%").arg(device));
+        }
 
         address = address.mid(0, address.length() - 4); // Remove the last OR.
 
         query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND l.Name LIKE '%%1%' AND (%2) "
-                        "ORDER BY l.Name, l.DeviceId").arg(filter).arg(address);
+                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND l.Name LIKE ? AND (%1) "
+                        "ORDER BY l.Name, l.DeviceId").arg(address);
     }
     else if (filter.isEmpty() && !devices.isEmpty()) // All on specific devices.
     {
         QString address;
         foreach (QString device, devices)
-            address += QString("d.Address LIKE '%%1%' OR ").arg(device);
+        {
+            address += "d.Address LIKE ? OR ";
+            addresses.append(QString("%%1%").arg(device));
+        }
 
         address = address.mid(0, address.length() - 4); // Remove the last OR.
 
@@ -1601,8 +1926,16 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByFilter(const QString& filt
                         "ORDER BY l.Name, l.DeviceId").arg(address);
     }
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+
+    // The placeholders for the filter come before the ones for the devices.
+    for (int i = query.count('?') - addresses.count(); i > 0; i--)
+        sql.addBindValue(QString("%%1%").arg(filter));
+
+    foreach (const QString& address, addresses)
+        sql.addBindValue(address);
+
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1611,6 +1944,8 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByFilter(const QString& filt
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1619,30 +1954,37 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByFilter(const QString& f
     QMutexLocker locker(&mutex);
 
     QString query;
+    QList<QString> addresses;
 
     if (!filter.isEmpty() && devices.isEmpty()) // Filter on all devices.
     {
         query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND (l.Name LIKE '%%1%' OR d.Name LIKE '%%1%' OR d.Address LIKE '%%1%') "
-                        "ORDER BY l.Name, l.DeviceId").arg(filter);
+                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND (l.Name LIKE ? OR d.Name LIKE ? OR d.Address LIKE ?) "
+                        "ORDER BY l.Name, l.DeviceId");
     }
     else if (!filter.isEmpty() && !devices.isEmpty()) // Filter specific devices.
     {
         QString address;
         foreach (QString device, devices)
-            address += QString("d.Address LIKE '%%1%' OR ").arg(device);
+        {
+            address += "d.Address LIKE ? OR ";
+            addresses.append(QString("%%1%").arg(device));
+        }
 
         address = address.mid(0, address.length() - 4); // Remove the last OR.
 
         query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND l.Name LIKE '%%1%' AND (%2) "
-                        "ORDER BY l.Name, l.DeviceId").arg(filter).arg(address);
+                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND l.Name LIKE ? AND (%1) "
+                        "ORDER BY l.Name, l.DeviceId").arg(address);
     }
     else if (filter.isEmpty() && !devices.isEmpty()) // All on specific devices.
     {
         QString address;
         foreach (QString device, devices)
-            address += QString("d.Address LIKE '%%1%' OR ").arg(device);
+        {
+            address += "d.Address LIKE ? OR ";
+            addresses.append(QString("%%1%").arg(device));
+        }
 
         address = address.mid(0, address.length() - 4); // Remove the last OR.
 
@@ -1651,8 +1993,16 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByFilter(const QString& f
                         "ORDER BY l.Name, l.DeviceId").arg(address);
     }
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+
+    // The placeholders for the filter come before the ones for the devices.
+    for (int i = query.count('?') - addresses.count(); i > 0; i--)
+        sql.addBindValue(QString("%%1%").arg(filter));
+
+    foreach (const QString& address, addresses)
+        sql.addBindValue(address);
+
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1661,6 +2011,8 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByFilter(const QString& f
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1669,30 +2021,37 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByFilter(const QString& filte
     QMutexLocker locker(&mutex);
 
     QString query;
+    QList<QString> addresses;
 
     if (!filter.isEmpty() && devices.isEmpty()) // Filter on all devices.
     {
         query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND (l.Name LIKE '%%1%' OR d.Name LIKE '%%1%' OR d.Address LIKE '%%1%') "
-                        "ORDER BY l.Name, l.DeviceId").arg(filter);
+                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND (l.Name LIKE ? OR d.Name LIKE ? OR d.Address LIKE ?) "
+                        "ORDER BY l.Name, l.DeviceId");
     }
     else if (!filter.isEmpty() && !devices.isEmpty()) // Filter specific devices.
     {
         QString address;
         foreach (QString device, devices)
-            address += QString("d.Address LIKE '%%1%' OR ").arg(device);
+        {
+            address += "d.Address LIKE ? OR ";
+            addresses.append(QString("%%1%").arg(device));
+        }
 
         address = address.mid(0, address.length() - 4); // Remove the last OR.
 
         query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND l.Name LIKE '%%1%' AND (%2) "
-                        "ORDER BY l.Name, l.DeviceId").arg(filter).arg(address);
+                        "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND l.Name LIKE ? AND (%1) "
+                        "ORDER BY l.Name, l.DeviceId").arg(address);
     }
     else if (filter.isEmpty() && !devices.isEmpty()) // All on specific devices.
     {
         QString address;
         foreach (QString device, devices)
-            address += QString("d.Address LIKE '%%1%' OR ").arg(device);
+        {
+            address += "d.Address LIKE ? OR ";
+            addresses.append(QString("%%1%").arg(device));
+        }
 
         address = address.mid(0, address.length() - 4); // Remove the last OR.
 
@@ -1701,8 +2060,16 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByFilter(const QString& filte
                         "ORDER BY l.Name, l.DeviceId").arg(address);
     }
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+
+    // The placeholders for the filter come before the ones for the devices.
+    for (int i = query.count('?') - addresses.count(); i > 0; i--)
+        sql.addBindValue(QString("%%1%").arg(filter));
+
+    foreach (const QString& address, addresses)
+        sql.addBindValue(address);
+
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1711,6 +2078,8 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByFilter(const QString& filte
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1718,12 +2087,13 @@ QList<LibraryModel> DatabaseManager::getLibraryByDeviceId(int deviceId)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                            "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND d.Id = %1 "
-                            "ORDER BY l.Name, l.DeviceId").arg(deviceId);
+    QString query("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                  "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND d.Id = ? "
+                  "ORDER BY l.Name, l.DeviceId");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(deviceId);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1732,6 +2102,8 @@ QList<LibraryModel> DatabaseManager::getLibraryByDeviceId(int deviceId)
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1739,12 +2111,13 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByDeviceAddress(const QStrin
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                            "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND d.Address = '%1' "
-                            "ORDER BY l.Id, l.DeviceId").arg(address);
+    QString query("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                  "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND (l.TypeId = 1 OR l.TypeId = 3 OR l.TypeId = 4) AND d.Address = ? "
+                  "ORDER BY l.Id, l.DeviceId");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(address);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1753,6 +2126,8 @@ QList<LibraryModel> DatabaseManager::getLibraryMediaByDeviceAddress(const QStrin
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1760,12 +2135,13 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByDeviceAddress(const QSt
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                            "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND d.Address = '%1' "
-                            "ORDER BY l.Id, l.DeviceId").arg(address);
+    QString query("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                  "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 5 AND d.Address = ? "
+                  "ORDER BY l.Id, l.DeviceId");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(address);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1774,6 +2150,8 @@ QList<LibraryModel> DatabaseManager::getLibraryTemplateByDeviceAddress(const QSt
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1781,12 +2159,13 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByDeviceAddress(const QString
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                            "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND d.Address = '%1' "
-                            "ORDER BY l.Id, l.DeviceId").arg(address);
+    QString query("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                  "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND l.TypeId = 2 AND d.Address = ? "
+                  "ORDER BY l.Id, l.DeviceId");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(address);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1795,6 +2174,8 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByDeviceAddress(const QString
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
     return models;
 }
 
@@ -1802,12 +2183,13 @@ QList<LibraryModel> DatabaseManager::getLibraryByNameAndDeviceId(const QString&
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                            "WHERE  l.Name = '%1' AND l.DeviceId = %2 AND l.DeviceId = d.Id AND l.TypeId = t.Id")
-                            .arg(name).arg(deviceId);
+    QString query("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                  "WHERE  l.Name = ? AND l.DeviceId = ? AND l.DeviceId = d.Id AND l.TypeId = t.Id");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(name);
+    sql.addBindValue(deviceId);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<LibraryModel> models;
@@ -1816,51 +2198,121 @@ QList<LibraryModel> DatabaseManager::getLibraryByNameAndDeviceId(const QString&
                                       sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
                                       sql.value(5).toString()));
 
+    sql.finish();
+
+    return models;
+}
+
+QList<LibraryModel> DatabaseManager::getLibraryById(const QList<int>& ids)
+{
+    QMutexLocker locker(&mutex);
+
+    QList<LibraryModel> models;
+    if (ids.isEmpty())
+        return models;
+
+    QStringList placeholders;
+    for (int i = 0; i < ids.count(); i++)
+        placeholders.append("?");
+
+    QString query = QString("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
+                            "WHERE l.Id IN (%1) AND l.DeviceId = d.Id AND l.TypeId = t.Id").arg(placeholders.join(", "));
+
+    QSqlQuery& sql = prepareQuery(query);
+    foreach (int id, ids)
+        sql.addBindValue(id);
+
+    if (!sql.exec())
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    QHash<int, LibraryModel> found;
+    while (sql.next())
+        found.insert(sql.value(0).toInt(), LibraryModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(1).toString(),
+                                                        sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
+                                                        sql.value(5).toString()));
+
+    sql.finish();
+
+    // In the order asked for, rows deleted since the ids were taken are left out.
+    foreach (int id, ids)
+    {
+        if (found.contains(id))
+            models.push_back(found.value(id));
+    }
+
     return models;
 }
 
-void DatabaseManager::updateLibraryMedia(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels)
+void DatabaseManager::updateLibraryMedia(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels,
+                                         const QList<LibraryModel>& updateModels)
 {
     QMutexLocker locker(&mutex);
 
     int deviceId = getDeviceByAddress(address).getId();
-    QList<TypeModel> typeModels = getType();
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QSqlQuery sql;
     if (deleteModels.count() > 0)
     {
-        for (int i = 0; i < deleteModels.count(); i++)
-        {
-            QString query = QString("DELETE FROM Library WHERE Id = %1").arg(deleteModels.at(i).getId());
+        QString query("DELETE FROM Library WHERE Id = ?");
 
-            if (!sql.exec(query))
-               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-        }
+        QVariantList ids;
+        foreach (const LibraryModel& model, deleteModels)
+            ids << model.getId();
+
+        // Statements are reused and execBatch(), unlike exec(), does not reset the positional binds. Bind by index.
+        QSqlQuery& sql = prepareQuery(query);
+        sql.bindValue(0, ids);
+        if (!sql.execBatch())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
     }
 
     if (insertModels.count() > 0)
     {
-        int typeId;
-        for (int i = 0; i < insertModels.count(); i++)
+        QString query("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) VALUES(?, ?, ?, ?, ?)");
+
+        QVariantList names, deviceIds, typeIds, thumbnailIds, timecodes;
+        foreach (const LibraryModel& model, insertModels)
         {
-            if (insertModels.at(i).getType() == "AUDIO")
-                typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName("AUDIO"))->getId();
-            else if (insertModels.at(i).getType() == "MOVIE")
-                typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName("MOVIE"))->getId();
-            else if (insertModels.at(i).getType() == "STILL")
-                typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName("STILL"))->getId();
+            names << model.getName();
+            deviceIds << deviceId;
+            typeIds << getTypeByValue(model.getType()).getId();
+            thumbnailIds << model.getThumbnailId();
+            timecodes << model.getTimecode();
+        }
 
-            QString query = QString("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) VALUES('%1', %2, %3, %4, '%5')")
-                                    .arg(insertModels.at(i).getName()).arg(deviceId).arg(typeId).arg(insertModels.at(i).getThumbnailId()).arg(insertModels.at(i).getTimecode());
+        QSqlQuery& sql = prepareQuery(query);
+        sql.bindValue(0, names);
+        sql.bindValue(1, deviceIds);
+        sql.bindValue(2, typeIds);
+        sql.bindValue(3, thumbnailIds);
+        sql.bindValue(4, timecodes);
+        if (!sql.execBatch())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    }
 
-            if (!sql.exec(query))
-               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+    if (updateModels.count() > 0)
+    {
+        QString query("UPDATE Library SET TypeId = ?, Timecode = ? WHERE Id = ?");
+
+        QVariantList typeIds, timecodes, ids;
+        foreach (const LibraryModel& model, updateModels)
+        {
+            typeIds << getTypeByValue(model.getType()).getId();
+            timecodes << model.getTimecode();
+            ids << model.getId();
         }
+
+        QSqlQuery& sql = prepareQuery(query);
+        sql.bindValue(0, typeIds);
+        sql.bindValue(1, timecodes);
+        sql.bindValue(2, ids);
+        if (!sql.execBatch())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
     }
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::updateLibraryTemplate(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels)
@@ -1868,36 +2320,50 @@ void DatabaseManager::updateLibraryTemplate(const QString& address, const QList<
     QMutexLocker locker(&mutex);
 
     int deviceId = getDeviceByAddress(address).getId();
-    QList<TypeModel> typeModels = getType();
-    int typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName("TEMPLATE"))->getId();
+    int typeId = getTypeByValue("TEMPLATE").getId();
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QSqlQuery sql;
     if (deleteModels.count() > 0)
     {
-        for (int i = 0; i < deleteModels.count(); i++)
-        {
-            QString query = QString("DELETE FROM Library WHERE Id = %1").arg(deleteModels.at(i).getId());
+        QString query("DELETE FROM Library WHERE Id = ?");
 
-            if (!sql.exec(query))
-               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-        }
+        QVariantList ids;
+        foreach (const LibraryModel& model, deleteModels)
+            ids << model.getId();
+
+        QSqlQuery& sql = prepareQuery(query);
+        sql.bindValue(0, ids);
+        if (!sql.execBatch())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
     }
 
     if (insertModels.count() > 0)
     {
-        for (int i = 0; i < insertModels.count(); i++)
-        {
-            QString query = QString("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) VALUES('%1', %2, %3, %4, '%5')")
-                                    .arg(insertModels.at(i).getName()).arg(deviceId).arg(typeId).arg(insertModels.at(i).getThumbnailId()).arg(insertModels.at(i).getTimecode());
+        QString query("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) VALUES(?, ?, ?, ?, ?)");
 
-            if (!sql.exec(query))
-               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+        QVariantList names, deviceIds, typeIds, thumbnailIds, timecodes;
+        foreach (const LibraryModel& model, insertModels)
+        {
+            names << model.getName();
+            deviceIds << deviceId;
+            typeIds << typeId;
+            thumbnailIds << model.getThumbnailId();
+            timecodes << model.getTimecode();
         }
+
+        QSqlQuery& sql = prepareQuery(query);
+        sql.bindValue(0, names);
+        sql.bindValue(1, deviceIds);
+        sql.bindValue(2, typeIds);
+        sql.bindValue(3, thumbnailIds);
+        sql.bindValue(4, timecodes);
+        if (!sql.execBatch())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
     }
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::updateLibraryData(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels)
@@ -1905,93 +2371,118 @@ void DatabaseManager::updateLibraryData(const QString& address, const QList<Libr
     QMutexLocker locker(&mutex);
 
     int deviceId = getDeviceByAddress(address).getId();
-    QList<TypeModel> typeModels = getType();
+    int typeId = getTypeByValue("DATA").getId();
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QSqlQuery sql;
     if (deleteModels.count() > 0)
     {
-        for (int i = 0; i < deleteModels.count(); i++)
-        {
-            QString query = QString("DELETE FROM Thumbnail WHERE Id = %1").arg(deleteModels.at(i).getThumbnailId());
+        QString thumbnailQuery("DELETE FROM Thumbnail WHERE Id = ?");
+        QString libraryQuery("DELETE FROM Library WHERE Id = ? AND TypeId = 2");
 
-            if (!sql.exec(query))
-               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+        QVariantList thumbnailIds, ids;
+        foreach (const LibraryModel& model, deleteModels)
+        {
+            thumbnailIds << model.getThumbnailId();
+            ids << model.getId();
+        }
 
-            query = QString("DELETE FROM Library WHERE Id = %1 AND TypeId = 2").arg(deleteModels.at(i).getId());
+        QSqlQuery& thumbnailSql = prepareQuery(thumbnailQuery);
+        thumbnailSql.bindValue(0, thumbnailIds);
+        if (!thumbnailSql.execBatch())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(thumbnailQuery).arg(thumbnailSql.lastError().text());
 
-            if (!sql.exec(query))
-               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-        }
+        QSqlQuery& librarySql = prepareQuery(libraryQuery);
+        librarySql.bindValue(0, ids);
+        if (!librarySql.execBatch())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(libraryQuery).arg(librarySql.lastError().text());
     }
 
     if (insertModels.count() > 0)
     {
-        int typeId;
-        for (int i = 0; i < insertModels.count(); i++)
-        {
-            if (insertModels.at(i).getType() == "DATA")
-                typeId = std::find_if(typeModels.begin(), typeModels.end(), TypeModel::ByName("DATA"))->getId();
-
-            QString query = QString("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) VALUES('%1', %2, %3, %4, '%5')")
-                                    .arg(insertModels.at(i).getName()).arg(deviceId).arg(typeId).arg(insertModels.at(i).getThumbnailId()).arg(insertModels.at(i).getTimecode());
+        QString query("INSERT INTO Library (Name, DeviceId, TypeId, ThumbnailId, Timecode) VALUES(?, ?, ?, ?, ?)");
 
-            if (!sql.exec(query))
-               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+        QVariantList names, deviceIds, typeIds, thumbnailIds, timecodes;
+        foreach (const LibraryModel& model, insertModels)
+        {
+            names << model.getName();
+            deviceIds << deviceId;
+            typeIds << typeId;
+            thumbnailIds << model.getThumbnailId();
+            timecodes << model.getTimecode();
         }
+
+        QSqlQuery& sql = prepareQuery(query);
+        sql.bindValue(0, names);
+        sql.bindValue(1, deviceIds);
+        sql.bindValue(2, typeIds);
+        sql.bindValue(3, thumbnailIds);
+        sql.bindValue(4, timecodes);
+        if (!sql.execBatch())
+           qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
     }
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 void DatabaseManager::deleteLibrary(int deviceId)
 {
     QMutexLocker locker(&mutex);
 
-    QSqlDatabase::database().transaction();
+    QSqlDatabase database = getDatabase();
+    database.transaction();
 
-    QString query = QString("DELETE FROM Library WHERE DeviceId = %1").arg(deviceId);
+    QString query("DELETE FROM Library WHERE DeviceId = ?");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(deviceId);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
-    QSqlDatabase::database().commit();
+    database.commit();
 }
 
 ThumbnailModel DatabaseManager::getThumbnailById(int id)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Address FROM Thumbnail t, Library l, Device d "
-                            "WHERE t.Id = %1 AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id").arg(id);
+    QString query("SELECT t.Id, i.Data, t.Timestamp, t.Size, l.Name, d.Address FROM Thumbnail t, ThumbnailImage i, Library l, Device d "
+                  "WHERE t.Id = ? AND t.ImageId = i.Id AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(id);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return ThumbnailModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
-                          sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString());
+    ThumbnailModel model(sql.value(0).toInt(), sql.value(1).toByteArray(), sql.value(2).toString(),
+                         sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString());
+    sql.finish();
+
+    return model;
 }
 
 QList<ThumbnailModel> DatabaseManager::getThumbnailByDeviceAddress(const QString& address)
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Address FROM Thumbnail t, Library l, Device d "
-                            "WHERE d.Address = '%1' AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id").arg(address);
+    // Only used to compare with the server, the images are left out.
+    QString query("SELECT t.Id, t.Timestamp, t.Size, l.Name, d.Address FROM Thumbnail t, Library l, Device d "
+                  "WHERE d.Address = ? AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(address);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     QList<ThumbnailModel> models;
     while (sql.next())
-        models.push_back(ThumbnailModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
-                                        sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString()));
+        models.push_back(ThumbnailModel(sql.value(0).toInt(), QByteArray(), sql.value(1).toString(),
+                                        sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toString()));
+
+    sql.finish();
 
     return models;
 }
@@ -2000,17 +2491,22 @@ ThumbnailModel DatabaseManager::getThumbnailByNameAndDeviceName(const QString& n
 {
     QMutexLocker locker(&mutex);
 
-    QString query = QString("SELECT t.Id, t.Data, t.Timestamp, t.Size, l.Name, d.Name, d.Address FROM Thumbnail t, Library l, Device d "
-                            "WHERE l.Name = '%1' AND d.Name = '%2' AND l.ThumbnailId = t.Id").arg(name).arg(deviceName);
+    QString query("SELECT t.Id, i.Data, t.Timestamp, t.Size, l.Name, d.Name, d.Address FROM Thumbnail t, ThumbnailImage i, Library l, Device d "
+                  "WHERE l.Name = ? AND d.Name = ? AND l.DeviceId = d.Id AND l.ThumbnailId = t.Id AND t.ImageId = i.Id");
 
-    QSqlQuery sql;
-    if (!sql.exec(query))
+    QSqlQuery& sql = prepareQuery(query);
+    sql.addBindValue(name);
+    sql.addBindValue(deviceName);
+    if (!sql.exec())
        qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
 
     sql.first();
 
-    return ThumbnailModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(),
-                          sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString());
+    ThumbnailModel model(sql.value(0).toInt(), sql.value(1).toByteArray(), sql.value(2).toString(),
+                         sql.value(3).toString(), sql.value(4).toString(), sql.value(5).toString());
+    sql.finish();
+
+    return model;
 }
 
 void DatabaseManager::updateThumbnail(const ThumbnailModel& model)
@@ -2020,36 +2516,270 @@ void DatabaseManager::updateThumbnail(const ThumbnailModel& model)
     int deviceId = getDeviceByAddress(model.getAddress()).getId();
     const QList<LibraryModel>& libraryModels = getLibraryByNameAndDeviceId(model.getName(), deviceId);
 
-    QSqlDatabase::database().transaction();
+    if (libraryModels.count() == 0)
+        return;
 
-    QSqlQuery sql;
-    if (libraryModels.count() > 0)
+    QSqlDatabase database = getDatabase();
+    database.transaction();
+
+    const int imageId = insertThumbnailImage(model.getData());
+
+    for (int i = 0; i < libraryModels.count(); i++)
     {
-        for (int i = 0; i < libraryModels.count(); i++)
+        const LibraryModel& libraryModel = libraryModels.at(i);
+        if (libraryModel.getThumbnailId() > 0)
         {
-            const LibraryModel& libraryModel = libraryModels.at(i);
-            if (libraryModel.getThumbnailId() > 0)
-            {
-                QString query = QString("UPDATE Thumbnail SET Data = '%1', Timestamp = '%2', Size = '%3' WHERE Id = %4")
-                                        .arg(model.getData()).arg(model.getTimestamp()).arg(model.getSize()).arg(libraryModel.getThumbnailId());
-
-                if (!sql.exec(query))
-                   qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-            }
-            else
-            {
-                QString query = QString("INSERT INTO Thumbnail (Data, Timestamp, Size) VALUES('%1', '%2', '%3')").arg(model.getData()).arg(model.getTimestamp()).arg(model.getSize());
-
-                if (!sql.exec(query))
-                   qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-
-                query = QString("UPDATE Library SET ThumbnailId = %1 WHERE Id = %2").arg(sql.lastInsertId().toInt()).arg(libraryModel.getId());
-
-                if (!sql.exec(query))
-                   qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
-            }
+            QString imageQuery("SELECT ImageId FROM Thumbnail WHERE Id = ?");
+
+            QSqlQuery& imageSql = prepareQuery(imageQuery);
+            imageSql.addBindValue(libraryModel.getThumbnailId());
+            if (!imageSql.exec())
+               qCritical() << QString("Failed to execute: %1, Error: %2").arg(imageQuery).arg(imageSql.lastError().text());
+
+            imageSql.first();
+
+            const int previousImageId = imageSql.value(0).toInt();
+            imageSql.finish();
+
+            QString query("UPDATE Thumbnail SET ImageId = ?, Timestamp = ?, Size = ? WHERE Id = ?");
+
+            QSqlQuery& sql = prepareQuery(query);
+            sql.addBindValue(imageId);
+            sql.addBindValue(model.getTimestamp());
+            sql.addBindValue(model.getSize());
+            sql.addBindValue(libraryModel.getThumbnailId());
+            if (!sql.exec())
+               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+            if (previousImageId > 0 && previousImageId != imageId)
+                removeThumbnailImage(previousImageId);
+        }
+        else
+        {
+            QString query("INSERT INTO Thumbnail (ImageId, Timestamp, Size) VALUES(?, ?, ?)");
+
+            QSqlQuery& sql = prepareQuery(query);
+            sql.addBindValue(imageId);
+            sql.addBindValue(model.getTimestamp());
+            sql.addBindValue(model.getSize());
+            if (!sql.exec())
+               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+            const int thumbnailId = sql.lastInsertId().toInt();
+
+            query = "UPDATE Library SET ThumbnailId = ? WHERE Id = ?";
+
+            QSqlQuery& librarySql = prepareQuery(query);
+            librarySql.addBindValue(thumbnailId);
+            librarySql.addBindValue(libraryModel.getId());
+            if (!librarySql.exec())
+               qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(librarySql.lastError().text());
         }
     }
 
-    QSqlDatabase::database().commit();
+    database.commit();
+}
+
+QSharedPointer<const DatabaseManager::DatabaseCache> DatabaseManager::getCache()
+{
+    QSharedPointer<const DatabaseCache> cache = getPublishedCache();
+    if (!cache.isNull())
+        return cache;
+
+    QMutexLocker locker(&mutex);
+
+    cache = getPublishedCache();
+    if (cache.isNull())
+    {
+        publishCache(loadCache());
+        cache = getPublishedCache();
+    }
+
+    return cache;
+}
+
+QSharedPointer<const DatabaseManager::DatabaseCache> DatabaseManager::getPublishedCache()
+{
+    QMutexLocker locker(&this->cacheMutex);
+
+    return this->cache;
+}
+
+void DatabaseManager::publishCache(DatabaseCache* cache)
+{
+    QMutexLocker locker(&mutex);
+
+    QSharedPointer<const DatabaseCache> previous(cache);
+    {
+        QMutexLocker cacheLocker(&this->cacheMutex);
+        qSwap(this->cache, previous);
+    }
+
+    // The previous cache is freed here, or by the last reader still holding it.
+}
+
+DatabaseManager::DatabaseCache* DatabaseManager::loadCache()
+{
+    QMutexLocker locker(&mutex);
+
+    DatabaseCache* cache = new DatabaseCache();
+    loadConfiguration(*cache);
+    loadFormat(*cache);
+    loadDevice(*cache);
+    loadLookup(*cache);
+
+    return cache;
+}
+
+bool DatabaseManager::reloadDevice()
+{
+    QMutexLocker locker(&mutex);
+
+    const QSharedPointer<const DatabaseCache> current = getCache();
+
+    DatabaseCache* cache = new DatabaseCache(*current);
+    loadDevice(*cache);
+
+    if (equalDevices(cache->devices, current->devices))
+    {
+        delete cache;
+        return false;
+    }
+
+    publishCache(cache);
+
+    return true;
+}
+
+bool DatabaseManager::equalDevices(const QList<DeviceModel>& devices, const QList<DeviceModel>& otherDevices)
+{
+    if (devices.count() != otherDevices.count())
+        return false;
+
+    for (int i = 0; i < devices.count(); i++)
+    {
+        const DeviceModel& device = devices.at(i);
+        const DeviceModel& other = otherDevices.at(i);
+        if (device.getId() != other.getId() || device.getName() != other.getName() || device.getAddress() != other.getAddress() ||
+            device.getPort() != other.getPort() || device.getUsername() != other.getUsername() || device.getPassword() != other.getPassword() ||
+            device.getDescription() != other.getDescription() || device.getVersion() != other.getVersion() || device.getShadow() != other.getShadow() ||
+            device.getChannels() != other.getChannels() || device.getChannelFormats() != other.getChannelFormats())
+            return false;
+    }
+
+    return true;
+}
+
+void DatabaseManager::loadConfiguration(DatabaseCache& cache)
+{
+    QString query("SELECT c.Id, c.Name, c.Value FROM Configuration c");
+
+    QSqlQuery sql;
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    cache.configurations.clear();
+    while (sql.next())
+        cache.configurations.push_back(ConfigurationModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString()));
+
+    cache.configurationIndex.clear();
+    for (int i = 0; i < cache.configurations.count(); i++)
+        cache.configurationIndex.insert(cache.configurations.at(i).getName(), i);
+}
+
+void DatabaseManager::loadFormat(DatabaseCache& cache)
+{
+    QString query = QString("SELECT f.Id, f.Name, f.Width, f.Height, f.FramesPerSecond FROM Format f");
+
+    QSqlQuery sql;
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    cache.formats.clear();
+    while (sql.next())
+        cache.formats.push_back(FormatModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toInt(), sql.value(3).toInt(), sql.value(4).toString()));
+
+    cache.formatIndex.clear();
+    for (int i = 0; i < cache.formats.count(); i++)
+        cache.formatIndex.insert(cache.formats.at(i).getName(), i);
+}
+
+void DatabaseManager::loadDevice(DatabaseCache& cache)
+{
+    QString query("SELECT d.Id, d.Name, d.Address, d.Port, d.Username, d.Password, d.Description, d.Version, d.Shadow, d.Channels, d.ChannelFormats FROM Device d "
+                  "ORDER BY d.Name");
+
+    QSqlQuery sql;
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    cache.devices.clear();
+    while (sql.next())
+        cache.devices.push_back(DeviceModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(2).toString(), sql.value(3).toInt(),
+                                            sql.value(4).toString(), sql.value(5).toString(), sql.value(6).toString(), sql.value(7).toString(),
+                                            sql.value(8).toString(), sql.value(9).toInt(), sql.value(10).toString()));
+
+    cache.deviceNameIndex.clear();
+    cache.deviceAddressIndex.clear();
+    for (int i = 0; i < cache.devices.count(); i++)
+    {
+        cache.deviceNameIndex.insert(cache.devices.at(i).getName(), i);
+        cache.deviceAddressIndex.insert(cache.devices.at(i).getAddress(), i);
+    }
+}
+
+void DatabaseManager::loadLookup(DatabaseCache& cache)
+{
+    QString query("SELECT b.Id, b.Value FROM BlendMode b");
+
+    QSqlQuery sql;
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    while (sql.next())
+        cache.blendModes.push_back(BlendModeModel(sql.value(0).toInt(), sql.value(1).toString()));
+
+    query = QString("SELECT c.Id, c.Key FROM Chroma c");
+
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    while (sql.next())
+        cache.chromas.push_back(ChromaModel(sql.value(0).toInt(), sql.value(1).toString()));
+
+    query = QString("SELECT d.Id, d.Value FROM Direction d");
+
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    while (sql.next())
+        cache.directions.push_back(DirectionModel(sql.value(0).toInt(), sql.value(1).toString()));
+
+    query = QString("SELECT t.Id, t.Value FROM Transition t");
+
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    while (sql.next())
+        cache.transitions.push_back(TransitionModel(sql.value(0).toInt(), sql.value(1).toString()));
+
+    query = QString("SELECT t.Id, t.Value FROM Tween t");
+
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    while (sql.next())
+        cache.tweens.push_back(TweenModel(sql.value(0).toInt(), sql.value(1).toString()));
+
+    query = QString("SELECT t.Id, t.Value FROM Type t");
+
+    if (!sql.exec(query))
+       qCritical() << QString("Failed to execute: %1, Error: %2").arg(query).arg(sql.lastError().text());
+
+    while (sql.next())
+        cache.types.push_back(TypeModel(sql.value(0).toInt(), sql.value(1).toString()));
+
+    cache.typeIndex.clear();
+    for (int i = 0; i < cache.types.count(); i++)
+        cache.typeIndex.insert(cache.types.at(i).getName(), i);
 }
@@ -39,13 +39,22 @@
 #include "Models/TriCaster/TriCasterDeviceModel.h"
 #include "Models/TriCaster/TriCasterNetworkTargetModel.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QMutex>
 #include <QtCore/QObject>
+#include <QtCore/QSharedPointer>
 
-class CORE_EXPORT DatabaseManager
+#include <QtSql/QSqlDatabase>
+#include <QtSql/QSqlQuery>
+
+class CORE_EXPORT DatabaseManager : public QObject
 {
+    Q_OBJECT
+
     public:
         explicit DatabaseManager();
+        ~DatabaseManager();
 
         static DatabaseManager& getInstance();
 
@@ -137,7 +146,9 @@ class CORE_EXPORT DatabaseManager
         QList<LibraryModel> getLibraryTemplateByDeviceAddress(const QString& address);
         QList<LibraryModel> getLibraryDataByDeviceAddress(const QString& address);
         QList<LibraryModel> getLibraryByNameAndDeviceId(const QString& name, int deviceId);
-        void updateLibraryMedia(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels);
+        QList<LibraryModel> getLibraryById(const QList<int>& ids);
+        void updateLibraryMedia(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels,
+                                const QList<LibraryModel>& updateModels);
         void updateLibraryTemplate(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels);
         void updateLibraryData(const QString& address, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels);
         void deleteLibrary(int deviceId);
@@ -147,6 +158,60 @@ class CORE_EXPORT DatabaseManager
         ThumbnailModel getThumbnailByNameAndDeviceName(const QString& name, const QString& deviceName);
         void updateThumbnail(const ThumbnailModel& model);
 
+        // Emitted after the change has been written, on the thread that made it.
+        Q_SIGNAL void configurationChanged(const QString& name);
+        Q_SIGNAL void deviceChanged();
+
     private:
+        // Configuration, Format, Device and the lookup tables are read all the time (every rundown item
+        // reads several when it is created and again on every take) but rarely written. They are kept in
+        // memory and read without taking the database mutex. Writers update the database first, then publish
+        // a new cache, readers hold on to the one they got and the last of them frees it.
+        struct DatabaseCache
+        {
+            QList<ConfigurationModel> configurations;
+            QHash<QString, int> configurationIndex;
+            QList<FormatModel> formats;
+            QHash<QString, int> formatIndex;
+            QList<DeviceModel> devices;
+            QHash<QString, int> deviceNameIndex;
+            QHash<QString, int> deviceAddressIndex;
+            QList<TypeModel> types;
+            QHash<QString, int> typeIndex;
+            QList<BlendModeModel> blendModes;
+            QList<ChromaModel> chromas;
+            QList<DirectionModel> directions;
+            QList<TransitionModel> transitions;
+            QList<TweenModel> tweens;
+        };
+
+        static const int CACHE_SIZE = 16384; // KiB
+        static const int MMAP_SIZE = 268435456;
+
         QMutex mutex;
+        QMutex cacheMutex; // Only held while the cache pointer is copied or replaced.
+        QSharedPointer<const DatabaseCache> cache;
+
+        // Prepared statements by connection name and SQL text. Values are bound, never formatted into the SQL,
+        // and a statement is only prepared the first time it is used. Only used while holding the mutex.
+        QHash<QString, QHash<QString, QSqlQuery> > statements;
+
+        void setupConnection(QSqlDatabase database);
+        void upgradeDatabase();
+        void removeUnusedThumbnails();
+        int insertThumbnailImage(const QByteArray& data);
+        void removeThumbnailImage(int id);
+        QSqlDatabase getDatabase();
+        QSqlQuery& prepareQuery(const QString& query);
+
+        QSharedPointer<const DatabaseCache> getCache();
+        QSharedPointer<const DatabaseCache> getPublishedCache();
+        void publishCache(DatabaseCache* cache);
+        DatabaseCache* loadCache();
+        bool reloadDevice(); // False when the devices did not change.
+        static bool equalDevices(const QList<DeviceModel>& devices, const QList<DeviceModel>& otherDevices);
+        void loadConfiguration(DatabaseCache& cache);
+        void loadFormat(DatabaseCache& cache);
+        void loadDevice(DatabaseCache& cache);
+        void loadLookup(DatabaseCache& cache);
 };
@@ -1,5 +1,6 @@
 #include "DeviceManager.h"
 #include "DatabaseManager.h"
+#include "ReconnectScheduler.h"
 #include "Events/ConnectionStateChangedEvent.h"
 #include "Events/DataChangedEvent.h"
 #include "Events/MediaChangedEvent.h"
@@ -18,6 +19,7 @@
 Q_GLOBAL_STATIC(DeviceManager, deviceManager)
 
 DeviceManager::DeviceManager()
+    : deferDepth(0)
 {
 }
 
@@ -38,8 +40,11 @@ void DeviceManager::initialize()
 
         emit deviceAdded(*device);
 
-        device->connectDevice();
+        QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        ReconnectScheduler::getInstance().addDevice(device.data());
     }
+
+    rebuildShadowDevices();
 }
 
 void DeviceManager::uninitialize()
@@ -47,6 +52,8 @@ void DeviceManager::uninitialize()
     foreach (const QString& key, this->devices.keys())
     {
         QSharedPointer<CasparDevice>& device = this->devices[key];
+
+        ReconnectScheduler::getInstance().removeDevice(device.data());
         device->disconnectDevice();
     }
 }
@@ -72,6 +79,7 @@ void DeviceManager::refresh()
 
         if (!foundDevice)
         {
+            ReconnectScheduler::getInstance().removeDevice(device.data());
             device->disconnectDevice();
 
             this->devices.remove(key);
@@ -84,7 +92,11 @@ void DeviceManager::refresh()
     // Connect new devices.
     foreach (DeviceModel model, models)
     {
-        if (!this->devices.contains(model.getName()))
+        if (this->devices.contains(model.getName()))
+        {
+            this->deviceModels.insert(model.getName(), model); // The shadow setting may have changed.
+        }
+        else
         {
             QSharedPointer<CasparDevice> device(new CasparDevice(model.getAddress(), model.getPort()));
 
@@ -93,9 +105,12 @@ void DeviceManager::refresh()
 
             emit deviceAdded(*device);
 
-            device->connectDevice();
+            QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            ReconnectScheduler::getInstance().addDevice(device.data());
         }
     }
+
+    rebuildShadowDevices();
 }
 
 QList<DeviceModel> DeviceManager::getDeviceModels() const
@@ -134,7 +149,83 @@ const int DeviceManager::getDeviceCount() const
     return this->devices.count();
 }
 
+void DeviceManager::beginDeferredMixer()
+{
+    this->deferDepth++;
+
+    foreach (const QSharedPointer<CasparDevice>& device, this->devices)
+        device->beginDeferredMixer();
+}
+
+void DeviceManager::commitDeferredMixer()
+{
+    if (this->deferDepth == 0)
+        return;
+
+    this->deferDepth--;
+
+    foreach (const QSharedPointer<CasparDevice>& device, this->devices)
+        device->commitDeferredMixer();
+}
+
+bool DeviceManager::isDeferringMixer() const
+{
+    return this->deferDepth > 0;
+}
+
+QString DeviceManager::dumpStatistics() const
+{
+    QStringList servers;
+    foreach (const QString& name, this->devices.keys())
+    {
+        const QSharedPointer<CasparDevice>& device = this->devices[name];
+        const AmcpDevice::AmcpLatencyStatistics latency = device->getLatencyStatistics();
+        const AmcpDevice::AmcpWriteStatistics& writes = device->getWriteStatistics();
+        const ReconnectScheduler::ReconnectStatistics reconnects = ReconnectScheduler::getInstance().getStatistics(device.data());
+
+        QString escapedName = name;
+        escapedName.replace("\\", "\\\\").replace("\"", "\\\"");
+
+        // Names are free text, fill them in with a single pass so they are never scanned for markers.
+        QString server = QString("{\"name\":\"%1\",\"address\":\"%2\",").arg(escapedName, device->getAddress());
+        server += QString("\"port\":%1,\"connected\":%2,\"pending\":%3,")
+                  .arg(device->getPort()).arg(device->isConnected() ? "true" : "false").arg(device->getPendingCount());
+        server += QString("\"latency\":{\"samples\":%1,\"failures\":%2,\"p50\":%3,\"p99\":%4,\"max\":%5,\"probes\":%6,\"lastProbe\":%7},")
+                  .arg(latency.samples).arg(latency.failures).arg(latency.median).arg(latency.percentile99)
+                  .arg(latency.maximum).arg(latency.probes).arg(latency.lastProbe);
+        server += QString("\"writes\":{\"flushes\":%1,\"commands\":%2,\"coalesced\":%3,\"bytes\":%4},")
+                  .arg(writes.flushes).arg(writes.commands).arg(writes.coalesced).arg(writes.bytes);
+        server += QString("\"reconnects\":{\"attempts\":%1,\"timeouts\":%2,\"connects\":%3,\"disconnects\":%4}}")
+                  .arg(reconnects.attempts).arg(reconnects.timeouts).arg(reconnects.connects).arg(reconnects.disconnects);
+
+        servers.append(server);
+    }
+
+    return QString("{\"servers\":[%1]}").arg(servers.join(","));
+}
+
 const QSharedPointer<CasparDevice> DeviceManager::getDeviceByName(const QString& name) const
 {
     return this->devices.value(name);
 }
+
+const QList<QSharedPointer<CasparDevice> >& DeviceManager::getShadowDevices() const
+{
+    return this->shadowDevices;
+}
+
+void DeviceManager::rebuildShadowDevices()
+{
+    this->shadowDevices.clear();
+
+    foreach (const DeviceModel& model, this->deviceModels)
+    {
+        if (model.getShadow() != "No" && this->devices.contains(model.getName()))
+            this->shadowDevices.append(this->devices.value(model.getName()));
+    }
+}
+
+void DeviceManager::deviceConnectionStateChanged(CasparDevice& device)
+{
+    ReconnectScheduler::getInstance().setConnected(&device, device.isConnected());
+}
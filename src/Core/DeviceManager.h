@@ -29,11 +29,30 @@ class CORE_EXPORT DeviceManager : public QObject
         const int getDeviceCount() const;
         const QSharedPointer<CasparDevice> getDeviceByName(const QString& name) const;
 
+        // Every command sent to a server is mirrored to these, the list is rebuilt when the devices change.
+        const QList<QSharedPointer<CasparDevice> >& getShadowDevices() const;
+
+        // Between these the mixer transforms are sent with DEFER and committed together when the outermost
+        // block is closed. Rundown items without a delay execute at once instead of from their timer while
+        // a block is open, so they are part of it.
+        void beginDeferredMixer();
+        void commitDeferredMixer();
+        bool isDeferringMixer() const;
+
+        // Connection health of all servers as JSON, latencies are in microseconds.
+        QString dumpStatistics() const;
+
         Q_SIGNAL void deviceRemoved();
         Q_SIGNAL void deviceAdded(CasparDevice&);
 
     private:
         QMap<QString, DeviceModel> deviceModels;
         QMap<QString, QSharedPointer<CasparDevice> > devices;
+        QList<QSharedPointer<CasparDevice> > shadowDevices;
+        int deferDepth;
+
+        void rebuildShadowDevices();
+
+        Q_SLOT void deviceConnectionStateChanged(CasparDevice& device);
 };
 
@@ -0,0 +1,232 @@
+#include "LibraryIndex.h"
+#include "DatabaseManager.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include <QtCore/QMutexLocker>
+#include <QtCore/QPair>
+#include <QtCore/QtAlgorithms>
+
+Q_GLOBAL_STATIC(LibraryIndex, libraryIndex)
+
+LibraryIndex::LibraryIndex()
+{
+}
+
+LibraryIndex& LibraryIndex::getInstance()
+{
+    return *libraryIndex();
+}
+
+quint64 LibraryIndex::trigram(const QString& name, int position)
+{
+    return (quint64(name.at(position).unicode()) << 32) | (quint64(name.at(position + 1).unicode()) << 16) | name.at(position + 2).unicode();
+}
+
+void LibraryIndex::update(const QString& address, const QStringList& types, const QList<LibraryModel>& models)
+{
+    QHash<QString, QList<LibraryModel> > modelsByType;
+    foreach (const LibraryModel& model, models)
+        modelsByType[model.getType()].push_back(model);
+
+    // Build outside the lock, searches keep using the old parts until they are replaced.
+    QHash<QString, LibraryIndexPartPointer> built;
+    foreach (const QString& type, types)
+    {
+        if (modelsByType.contains(type))
+            built.insert(type, buildPart(address, modelsByType.value(type)));
+    }
+
+    QMutexLocker locker(&this->mutex);
+
+    foreach (const QString& type, types)
+    {
+        if (built.contains(type))
+            this->parts[type].insert(address, built.value(type));
+        else
+            this->parts[type].remove(address);
+    }
+}
+
+void LibraryIndex::clear()
+{
+    QMutexLocker locker(&this->mutex);
+
+    this->parts.clear();
+}
+
+LibraryIndex::LibraryIndexPartPointer LibraryIndex::buildPart(const QString& address, const QList<LibraryModel>& models)
+{
+    QVector<QPair<QString, int> > entries;
+    entries.reserve(models.count());
+    foreach (const LibraryModel& model, models)
+        entries.push_back(qMakePair(model.getName().toLower(), model.getId()));
+
+    qSort(entries);
+
+    QSharedPointer<LibraryIndexPart> part(new LibraryIndexPart());
+    part->address = address;
+    part->ids.reserve(entries.count());
+    part->names.reserve(entries.count());
+    part->all.reserve(entries.count());
+
+    for (int i = 0; i < entries.count(); i++)
+    {
+        const QString& name = entries.at(i).first;
+
+        part->ids.push_back(entries.at(i).second);
+        part->names.push_back(name);
+        part->all.push_back(i);
+
+        // Entries are added in name order, so every posting list stays sorted.
+        for (int position = 0; position + 3 <= name.length(); position++)
+        {
+            QVector<int>& postings = part->trigrams[trigram(name, position)];
+            if (postings.isEmpty() || postings.last() != i)
+                postings.push_back(i);
+        }
+    }
+
+    return part;
+}
+
+void LibraryIndex::findMatches(const LibraryIndexPart& part, const QString& filter, QVector<int> (&matches)[RankCount])
+{
+    if (filter.isEmpty())
+    {
+        matches[Exact] = part.all;
+        return;
+    }
+
+    QVector<int> candidates;
+    if (filter.length() < 3)
+    {
+        candidates = part.all;
+    }
+    else
+    {
+        QList<QVector<int> > postings;
+        for (int position = 0; position + 3 <= filter.length(); position++)
+        {
+            QHash<quint64, QVector<int> >::const_iterator found = part.trigrams.constFind(trigram(filter, position));
+            if (found == part.trigrams.constEnd())
+                return;
+
+            postings.push_back(found.value());
+        }
+
+        // Intersect starting with the shortest list, it bounds the work for the rest.
+        int shortest = 0;
+        for (int i = 1; i < postings.count(); i++)
+        {
+            if (postings.at(i).count() < postings.at(shortest).count())
+                shortest = i;
+        }
+
+        candidates = postings.at(shortest);
+        for (int i = 0; i < postings.count() && !candidates.isEmpty(); i++)
+        {
+            if (i == shortest)
+                continue;
+
+            QVector<int> intersection;
+            std::set_intersection(candidates.begin(), candidates.end(), postings.at(i).begin(), postings.at(i).end(),
+                                  std::back_inserter(intersection));
+            candidates = intersection;
+        }
+    }
+
+    // Having all the trigrams doesn't mean they are next to each other.
+    foreach (int candidate, candidates)
+    {
+        const int position = part.names.at(candidate).indexOf(filter);
+        if (position >= 0)
+            matches[rankMatch(part.names.at(candidate), filter, position)].push_back(candidate);
+    }
+}
+
+LibraryIndex::LibraryRank LibraryIndex::rankMatch(const QString& name, const QString& filter, int position)
+{
+    if (position == 0)
+        return (name.length() == filter.length()) ? Exact : Prefix;
+
+    for (; position > 0; position = name.indexOf(filter, position + 1))
+    {
+        if (!name.at(position - 1).isLetterOrNumber())
+            return Word;
+    }
+
+    return Anywhere;
+}
+
+QList<LibraryModel> LibraryIndex::search(const QString& type, const QString& filter, const QList<QString>& devices, int offset, int limit, int& total)
+{
+    QList<LibraryIndexPartPointer> parts;
+    {
+        QMutexLocker locker(&this->mutex);
+
+        foreach (const LibraryIndexPartPointer& part, this->parts.value(type))
+        {
+            if (devices.isEmpty() || devices.contains(part->address))
+                parts.push_back(part);
+        }
+    }
+
+    const QString lowerFilter = filter.toLower();
+
+    total = 0;
+    QVector<LibraryMatches> lists;
+    foreach (const LibraryIndexPartPointer& part, parts)
+    {
+        QVector<int> matches[RankCount];
+        findMatches(*part, lowerFilter, matches);
+
+        for (int rank = 0; rank < RankCount; rank++)
+        {
+            if (matches[rank].isEmpty())
+                continue;
+
+            LibraryMatches list = { part, matches[rank], rank, 0 };
+            lists.push_back(list);
+
+            total += matches[rank].count();
+        }
+    }
+
+    // Every list is in name order, merge them until the end of the page.
+    QList<int> ids;
+    for (int count = 0; count < offset + limit; count++)
+    {
+        int next = -1;
+        for (int i = 0; i < lists.count(); i++)
+        {
+            if (lists.at(i).position < lists.at(i).entries.count() && (next < 0 || precedes(lists.at(i), lists.at(next))))
+                next = i;
+        }
+
+        if (next < 0)
+            break;
+
+        LibraryMatches& list = lists[next];
+        if (count >= offset)
+            ids.push_back(list.part->ids.at(list.entries.at(list.position)));
+
+        list.position++;
+    }
+
+    return DatabaseManager::getInstance().getLibraryById(ids);
+}
+
+bool LibraryIndex::precedes(const LibraryMatches& first, const LibraryMatches& second)
+{
+    if (first.rank != second.rank)
+        return first.rank < second.rank;
+
+    const QString& firstName = first.part->names.at(first.entries.at(first.position));
+    const QString& secondName = second.part->names.at(second.entries.at(second.position));
+    if (firstName != secondName)
+        return firstName < secondName;
+
+    return first.part->address < second.part->address;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/LibraryModel.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+// In-memory search index over the names in the library, used by the library filter instead of a LIKE scan
+// of the Library table. Names are split into trigrams, a filter of three characters or more only looks at
+// the names that contain all of its trigrams. The index is kept per type and device so a refresh of one
+// server only rebuilds that part, see LibrarySynchronizer.
+class CORE_EXPORT LibraryIndex
+{
+    public:
+        explicit LibraryIndex();
+
+        static LibraryIndex& getInstance();
+
+        // Replaces everything indexed for the given types on the device.
+        void update(const QString& address, const QStringList& types, const QList<LibraryModel>& models);
+        void clear();
+
+        // Matches of one type ranked exact, prefix, start of word and anywhere in the name, then by name.
+        // An empty filter matches everything (ranked as exact), an empty device list means all devices. The page is read
+        // from the database so it always has the current thumbnail and timecode.
+        QList<LibraryModel> search(const QString& type, const QString& filter, const QList<QString>& devices, int offset, int limit, int& total);
+
+    private:
+        enum LibraryRank
+        {
+            Exact,
+            Prefix,
+            Word,
+            Anywhere,
+            RankCount
+        };
+
+        // One type on one device. Never changed once published, a search holds on to the parts it uses.
+        struct LibraryIndexPart
+        {
+            QString address;
+            QVector<int> ids;
+            QVector<QString> names; // Lower case, sorted.
+            QVector<int> all;
+            QHash<quint64, QVector<int> > trigrams;
+        };
+
+        typedef QSharedPointer<const LibraryIndexPart> LibraryIndexPartPointer;
+
+        struct LibraryMatches
+        {
+            LibraryIndexPartPointer part;
+            QVector<int> entries; // Name order.
+            int rank;
+            int position;
+        };
+
+        QMutex mutex;
+        QHash<QString, QHash<QString, LibraryIndexPartPointer> > parts; // By type, then device address.
+
+        static quint64 trigram(const QString& name, int position);
+        static LibraryIndexPartPointer buildPart(const QString& address, const QList<LibraryModel>& models);
+        static void findMatches(const LibraryIndexPart& part, const QString& filter, QVector<int> (&matches)[RankCount]);
+        static LibraryRank rankMatch(const QString& name, const QString& filter, int position);
+        static bool precedes(const LibraryMatches& first, const LibraryMatches& second);
+};
@@ -10,8 +10,8 @@
 #include "Events/Inspector/TemplateChangedEvent.h"
 #include "Models/DeviceModel.h"
 
+#include <QtCore/QMetaType>
 #include <QtCore/QSharedPointer>
-#include <QtCore/QTime>
 #include <QtCore/QTimer>
 #include <QtCore/QStringList>
 
@@ -20,15 +20,38 @@
 Q_GLOBAL_STATIC(LibraryManager, libraryManager)
 
 LibraryManager::LibraryManager(QObject* parent)
-    : QObject(parent)
+    : QObject(parent),
+      synchronizer(new LibrarySynchronizer())
 {
+    qRegisterMetaType<QList<ThumbnailModel> >("QList<ThumbnailModel>");
+
+    // Comparing and writing a large library takes long enough to stall the GUI, it is done in a thread
+    // of its own. The events are fired from here once the database has been updated.
+    this->synchronizer->moveToThread(&this->thread);
+    QObject::connect(this->synchronizer, SIGNAL(indexLoaded()), this, SLOT(indexLoaded()));
+    QObject::connect(this->synchronizer, SIGNAL(mediaSynchronized()), this, SLOT(mediaSynchronized()));
+    QObject::connect(this->synchronizer, SIGNAL(templateSynchronized()), this, SLOT(templateSynchronized()));
+    QObject::connect(this->synchronizer, SIGNAL(dataSynchronized()), this, SLOT(dataSynchronized()));
+    QObject::connect(this->synchronizer, SIGNAL(thumbnailSynchronized(const QList<ThumbnailModel>&)), this, SLOT(thumbnailSynchronized(const QList<ThumbnailModel>&)));
+
+    this->thread.setObjectName("LibraryThread");
+    this->thread.start();
+
     QObject::connect(&this->refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+    QObject::connect(&DatabaseManager::getInstance(), SIGNAL(deviceChanged()), this, SLOT(deviceChanged()));
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceRemoved()), this, SLOT(deviceRemoved()));
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(autoRefreshLibrary(const AutoRefreshLibraryEvent&)), this, SLOT(autoRefreshLibrary(const AutoRefreshLibraryEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(refreshLibrary(const RefreshLibraryEvent&)), this, SLOT(refreshLibrary(const RefreshLibraryEvent&)));
 }
 
+LibraryManager::~LibraryManager()
+{
+    uninitialize();
+
+    delete this->synchronizer;
+}
+
 LibraryManager& LibraryManager::getInstance()
 {
     return *libraryManager();
@@ -36,6 +59,8 @@ LibraryManager& LibraryManager::getInstance()
 
 void LibraryManager::initialize()
 {
+    deviceChanged();
+
     EventManager::getInstance().fireRefreshLibraryEvent(RefreshLibraryEvent());
     EventManager::getInstance().fireAutoRefreshLibraryEvent(AutoRefreshLibraryEvent((DatabaseManager::getInstance().getConfigurationByName("AutoRefreshLibrary").getValue() == "true") ? true : false,
                                                                                     DatabaseManager::getInstance().getConfigurationByName("RefreshLibraryInterval").getValue().toInt() * 1000));
@@ -43,6 +68,9 @@ void LibraryManager::initialize()
 
 void LibraryManager::uninitialize()
 {
+    // Let a write in progress finish, anything still queued is dropped.
+    this->thread.quit();
+    this->thread.wait();
 }
 
 void LibraryManager::refreshLibrary(const RefreshLibraryEvent& event)
@@ -153,164 +181,68 @@ void LibraryManager::connectionStateChanged(CasparDevice& device)
 
 void LibraryManager::mediaChanged(const QList<CasparMedia>& mediaItems, CasparDevice& device)
 {
-    QTime time;
-    time.start();
-
-    QList<LibraryModel> insertModels;
-    QList<LibraryModel> deleteModels;
-    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(device.getAddress());
-
-    // Find library items to delete.
-    foreach (const LibraryModel& libraryModel, libraryModels)
-    {
-        bool found = false;
-        foreach (CasparMedia mediaItem, mediaItems)
-        {
-            if (mediaItem.getName() == libraryModel.getName())
-                found = true;
-        }
-
-        if (!found)
-            deleteModels.push_back(libraryModel);
-    }
-
-    // Find library items to insert.
-    foreach (CasparMedia mediaItem, mediaItems)
-    {
-        bool found = false;
-        foreach (const LibraryModel& libraryModel, libraryModels)
-        {
-            if (libraryModel.getName() == mediaItem.getName())
-                found = true;
-        }
-
-        if (!found)
-            insertModels.push_back(LibraryModel(0, mediaItem.getName(), mediaItem.getName(), "", mediaItem.getType(), 0, mediaItem.getTimecode()));
-    }
-
-    if (deleteModels.count() > 0 || insertModels.count() > 0)
-    {
-        DatabaseManager::getInstance().updateLibraryMedia(device.getAddress(), deleteModels, insertModels);
-        EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
-    }
-
-    qDebug() << QString("LibraryManager::deviceMediaChanged: %1 msec").arg(time.elapsed());
+    QMetaObject::invokeMethod(this->synchronizer, "synchronizeMedia", Qt::QueuedConnection,
+                              Q_ARG(QString, device.getAddress()), Q_ARG(QList<CasparMedia>, mediaItems));
 }
 
 void LibraryManager::templateChanged(const QList<CasparTemplate>& templateItems, CasparDevice& device)
 {
-    QTime time;
-    time.start();
-
-    QList<LibraryModel> insertModels;
-    QList<LibraryModel> deleteModels;
-    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryTemplateByDeviceAddress(device.getAddress());
-
-    // Find library items to delete.
-    foreach (const LibraryModel& libraryModel, libraryModels)
-    {
-        bool found = false;
-        foreach (CasparTemplate templateItem, templateItems)
-        {
-            if (templateItem.getName() == libraryModel.getName())
-                found = true;
-        }
-
-        if (!found)
-            deleteModels.push_back(libraryModel);
-    }
-
-    // Find library items to insert.
-    foreach (CasparTemplate templateItem, templateItems)
-    {
-        bool found = false;
-        foreach (const LibraryModel& libraryModel, libraryModels)
-        {
-            if (libraryModel.getName() == templateItem.getName())
-                found = true;
-        }
-
-        if (!found)
-            insertModels.push_back(LibraryModel(0, templateItem.getName(), templateItem.getName(), "", "TEMPLATE", 0, ""));
-    }
-
-    if (deleteModels.count() > 0 || insertModels.count() > 0)
-    {
-        DatabaseManager::getInstance().updateLibraryTemplate(device.getAddress(), deleteModels, insertModels);
-        EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
-    }
-
-    qDebug() << QString("LibraryManager::deviceTemplateChanged: %1 msec").arg(time.elapsed());
+    QMetaObject::invokeMethod(this->synchronizer, "synchronizeTemplate", Qt::QueuedConnection,
+                              Q_ARG(QString, device.getAddress()), Q_ARG(QList<CasparTemplate>, templateItems));
 }
 
 void LibraryManager::dataChanged(const QList<CasparData>& dataItems, CasparDevice& device)
 {
-    QTime time;
-    time.start();
-
-    QList<LibraryModel> insertModels;
-    QList<LibraryModel> deleteModels;
-    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryDataByDeviceAddress(device.getAddress());
+    QMetaObject::invokeMethod(this->synchronizer, "synchronizeData", Qt::QueuedConnection,
+                              Q_ARG(QString, device.getAddress()), Q_ARG(QList<CasparData>, dataItems));
+}
 
-    // Find library items to delete.
-    foreach (const LibraryModel& libraryModel, libraryModels)
-    {
-        bool found = false;
-        foreach (CasparData dataItem, dataItems)
-        {
-            if (dataItem.getName() == libraryModel.getName())
-                found = true;
-        }
+void LibraryManager::thumbnailChanged(const QList<CasparThumbnail>& thumbnailItems, CasparDevice& device)
+{
+    QMetaObject::invokeMethod(this->synchronizer, "synchronizeThumbnail", Qt::QueuedConnection,
+                              Q_ARG(QString, device.getAddress()), Q_ARG(QList<CasparThumbnail>, thumbnailItems));
+}
 
-        if (!found)
-            deleteModels.push_back(libraryModel);
-    }
+void LibraryManager::deviceChanged()
+{
+    // The index is kept by device address and removing a device removes its library. Version and
+    // channel updates, written on every refresh, don't change the index.
+    QMap<int, QString> deviceAddresses;
+    foreach (const DeviceModel& model, DatabaseManager::getInstance().getDevice())
+        deviceAddresses.insert(model.getId(), model.getAddress());
 
-    // Find library items to insert.
-    foreach (CasparData dataItem, dataItems)
-    {
-        bool found = false;
-        foreach (const LibraryModel& libraryModel, libraryModels)
-        {
-            if (libraryModel.getName() == dataItem.getName())
-                found = true;
-        }
+    if (deviceAddresses == this->deviceAddresses)
+        return;
 
-        if (!found)
-            insertModels.push_back(LibraryModel(0, dataItem.getName(), dataItem.getName(), "", "DATA", 0, ""));
-    }
+    this->deviceAddresses = deviceAddresses;
 
-    if (deleteModels.count() > 0 || insertModels.count() > 0)
-    {
-        DatabaseManager::getInstance().updateLibraryData(device.getAddress(), deleteModels, insertModels);
-        EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
-    }
+    QMetaObject::invokeMethod(this->synchronizer, "loadIndex", Qt::QueuedConnection);
+}
 
-    qDebug() << QString("LibraryManager::deviceDataChanged: %1 msec").arg(time.elapsed());
+void LibraryManager::indexLoaded()
+{
+    EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
+    EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
+    EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
 }
 
-void LibraryManager::thumbnailChanged(const QList<CasparThumbnail>& thumbnailItems, CasparDevice& device)
+void LibraryManager::mediaSynchronized()
 {
-    QList<ThumbnailModel> processModels;
-    QList<ThumbnailModel> thumbnailModels = DatabaseManager::getInstance().getThumbnailByDeviceAddress(device.getAddress());
+    EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
+}
 
-    // Find thumbnail items to process.
-    foreach (CasparThumbnail thumbnailItem, thumbnailItems)
-    {
-        bool found = false;
-        foreach (const ThumbnailModel& thumbnailModel, thumbnailModels)
-        {
-            if (thumbnailModel.getName() == thumbnailItem.getName() &&
-                thumbnailModel.getTimestamp() == thumbnailItem.getTimestamp() &&
-                thumbnailModel.getSize() == thumbnailItem.getSize())
-                found = true;
-        }
+void LibraryManager::templateSynchronized()
+{
+    EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
+}
 
-        if (!found)
-            processModels.push_back(ThumbnailModel(0, "", thumbnailItem.getTimestamp(), thumbnailItem.getSize(),
-                                                   thumbnailItem.getName(), device.getAddress()));
-    }
+void LibraryManager::dataSynchronized()
+{
+    EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
+}
 
+void LibraryManager::thumbnailSynchronized(const QList<ThumbnailModel>& processModels)
+{
     QSharedPointer<ThumbnailWorker> thumbnailWorker(new ThumbnailWorker(processModels));
     thumbnailWorker->start();
 
@@ -6,6 +6,7 @@
 
 #include "CasparDevice.h"
 
+#include "LibrarySynchronizer.h"
 #include "ThumbnailWorker.h"
 #include "Events/Library/RefreshLibraryEvent.h"
 #include "Events/Library/AutoRefreshLibraryEvent.h"
@@ -14,8 +15,10 @@
 #include "Models/CasparTemplate.h"
 #include "Models/CasparThumbnail.h"
 
+#include <QtCore/QMap>
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QThread>
 #include <QtCore/QTimer>
 
 class CORE_EXPORT LibraryManager : public QObject
@@ -24,6 +27,7 @@ class CORE_EXPORT LibraryManager : public QObject
 
     public:
         explicit LibraryManager(QObject* parent = 0);
+        ~LibraryManager();
 
         static LibraryManager& getInstance();
 
@@ -32,6 +36,9 @@ class CORE_EXPORT LibraryManager : public QObject
 
     private:
         QTimer refreshTimer;
+        QThread thread; // Compares and writes the library, see LibrarySynchronizer.
+        LibrarySynchronizer* synchronizer;
+        QMap<int, QString> deviceAddresses; // What the search index was last loaded for.
         QList<QSharedPointer<ThumbnailWorker> > thumbnailWorkers;
 
         Q_SLOT void refresh();
@@ -44,6 +51,12 @@ class CORE_EXPORT LibraryManager : public QObject
         Q_SLOT void templateChanged(const QList<CasparTemplate>&, CasparDevice&);
         Q_SLOT void dataChanged(const QList<CasparData>&, CasparDevice&);
         Q_SLOT void thumbnailChanged(const QList<CasparThumbnail>&, CasparDevice&);
+        Q_SLOT void deviceChanged();
+        Q_SLOT void indexLoaded();
+        Q_SLOT void mediaSynchronized();
+        Q_SLOT void templateSynchronized();
+        Q_SLOT void dataSynchronized();
+        Q_SLOT void thumbnailSynchronized(const QList<ThumbnailModel>&);
 
         Q_SLOT void refreshLibrary(const RefreshLibraryEvent&);
         Q_SLOT void autoRefreshLibrary(const AutoRefreshLibraryEvent&);
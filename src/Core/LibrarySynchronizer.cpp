@@ -0,0 +1,190 @@
+#include "LibrarySynchronizer.h"
+#include "DatabaseManager.h"
+#include "LibraryIndex.h"
+
+#include <QtCore/QDebug>
+#include <QtCore/QSet>
+#include <QtCore/QStringList>
+#include <QtCore/QTime>
+
+LibrarySynchronizer::LibrarySynchronizer(QObject* parent)
+    : QObject(parent)
+{
+}
+
+void LibrarySynchronizer::loadIndex()
+{
+    QTime time;
+    time.start();
+
+    QHash<QString, QList<LibraryModel> > modelsByDevice;
+    foreach (const LibraryModel& model, DatabaseManager::getInstance().getLibraryMedia() +
+                                        DatabaseManager::getInstance().getLibraryTemplate() +
+                                        DatabaseManager::getInstance().getLibraryData())
+        modelsByDevice[model.getDeviceName()].push_back(model);
+
+    const QStringList types = QStringList() << "AUDIO" << "MOVIE" << "STILL" << "TEMPLATE" << "DATA";
+
+    LibraryIndex::getInstance().clear();
+    for (QHash<QString, QList<LibraryModel> >::const_iterator models = modelsByDevice.constBegin(); models != modelsByDevice.constEnd(); ++models)
+        LibraryIndex::getInstance().update(DatabaseManager::getInstance().getDeviceByName(models.key()).getAddress(), types, models.value());
+
+    emit indexLoaded();
+
+    qDebug() << QString("LibrarySynchronizer::loadIndex: %1 msec").arg(time.elapsed());
+}
+
+QHash<QString, int> LibrarySynchronizer::indexByName(const QList<LibraryModel>& libraryModels)
+{
+    QHash<QString, int> index;
+    index.reserve(libraryModels.count());
+
+    for (int i = 0; i < libraryModels.count(); i++)
+        index.insert(libraryModels.at(i).getName(), i);
+
+    return index;
+}
+
+void LibrarySynchronizer::findDeleted(const QList<LibraryModel>& libraryModels, const QVector<bool>& found, QList<LibraryModel>& deleteModels)
+{
+    for (int i = 0; i < libraryModels.count(); i++)
+    {
+        if (!found.at(i))
+            deleteModels.push_back(libraryModels.at(i));
+    }
+}
+
+void LibrarySynchronizer::synchronizeMedia(const QString& address, const QList<CasparMedia>& mediaItems)
+{
+    QTime time;
+    time.start();
+
+    QList<LibraryModel> insertModels;
+    QList<LibraryModel> deleteModels;
+    QList<LibraryModel> updateModels;
+    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(address);
+
+    const QHash<QString, int> index = indexByName(libraryModels);
+    QVector<bool> found(libraryModels.count(), false);
+
+    // New clips are inserted, clips that were replaced on the server get their type and timecode updated.
+    foreach (const CasparMedia& mediaItem, mediaItems)
+    {
+        QHash<QString, int>::const_iterator position = index.constFind(mediaItem.getName());
+        if (position == index.constEnd())
+        {
+            insertModels.push_back(LibraryModel(0, mediaItem.getName(), mediaItem.getName(), "", mediaItem.getType(), 0, mediaItem.getTimecode()));
+            continue;
+        }
+
+        found[position.value()] = true;
+
+        const LibraryModel& libraryModel = libraryModels.at(position.value());
+        if (libraryModel.getType() != mediaItem.getType() || libraryModel.getTimecode() != mediaItem.getTimecode())
+            updateModels.push_back(LibraryModel(libraryModel.getId(), libraryModel.getLabel(), libraryModel.getName(), libraryModel.getDeviceName(),
+                                                mediaItem.getType(), libraryModel.getThumbnailId(), mediaItem.getTimecode()));
+    }
+
+    findDeleted(libraryModels, found, deleteModels);
+
+    if (deleteModels.count() > 0 || insertModels.count() > 0 || updateModels.count() > 0)
+    {
+        DatabaseManager::getInstance().updateLibraryMedia(address, deleteModels, insertModels, updateModels);
+        LibraryIndex::getInstance().update(address, QStringList() << "AUDIO" << "MOVIE" << "STILL",
+                                           DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(address));
+        emit mediaSynchronized();
+    }
+
+    qDebug() << QString("LibraryManager::deviceMediaChanged: %1 msec").arg(time.elapsed());
+}
+
+void LibrarySynchronizer::synchronizeTemplate(const QString& address, const QList<CasparTemplate>& templateItems)
+{
+    QTime time;
+    time.start();
+
+    QList<LibraryModel> insertModels;
+    QList<LibraryModel> deleteModels;
+    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryTemplateByDeviceAddress(address);
+
+    const QHash<QString, int> index = indexByName(libraryModels);
+    QVector<bool> found(libraryModels.count(), false);
+
+    foreach (const CasparTemplate& templateItem, templateItems)
+    {
+        QHash<QString, int>::const_iterator position = index.constFind(templateItem.getName());
+        if (position == index.constEnd())
+            insertModels.push_back(LibraryModel(0, templateItem.getName(), templateItem.getName(), "", "TEMPLATE", 0, ""));
+        else
+            found[position.value()] = true;
+    }
+
+    findDeleted(libraryModels, found, deleteModels);
+
+    if (deleteModels.count() > 0 || insertModels.count() > 0)
+    {
+        DatabaseManager::getInstance().updateLibraryTemplate(address, deleteModels, insertModels);
+        LibraryIndex::getInstance().update(address, QStringList() << "TEMPLATE",
+                                           DatabaseManager::getInstance().getLibraryTemplateByDeviceAddress(address));
+        emit templateSynchronized();
+    }
+
+    qDebug() << QString("LibraryManager::deviceTemplateChanged: %1 msec").arg(time.elapsed());
+}
+
+void LibrarySynchronizer::synchronizeData(const QString& address, const QList<CasparData>& dataItems)
+{
+    QTime time;
+    time.start();
+
+    QList<LibraryModel> insertModels;
+    QList<LibraryModel> deleteModels;
+    QList<LibraryModel> libraryModels = DatabaseManager::getInstance().getLibraryDataByDeviceAddress(address);
+
+    const QHash<QString, int> index = indexByName(libraryModels);
+    QVector<bool> found(libraryModels.count(), false);
+
+    foreach (const CasparData& dataItem, dataItems)
+    {
+        QHash<QString, int>::const_iterator position = index.constFind(dataItem.getName());
+        if (position == index.constEnd())
+            insertModels.push_back(LibraryModel(0, dataItem.getName(), dataItem.getName(), "", "DATA", 0, ""));
+        else
+            found[position.value()] = true;
+    }
+
+    findDeleted(libraryModels, found, deleteModels);
+
+    if (deleteModels.count() > 0 || insertModels.count() > 0)
+    {
+        DatabaseManager::getInstance().updateLibraryData(address, deleteModels, insertModels);
+        LibraryIndex::getInstance().update(address, QStringList() << "DATA",
+                                           DatabaseManager::getInstance().getLibraryDataByDeviceAddress(address));
+        emit dataSynchronized();
+    }
+
+    qDebug() << QString("LibraryManager::deviceDataChanged: %1 msec").arg(time.elapsed());
+}
+
+void LibrarySynchronizer::synchronizeThumbnail(const QString& address, const QList<CasparThumbnail>& thumbnailItems)
+{
+    QTime time;
+    time.start();
+
+    QSet<QString> thumbnails;
+    foreach (const ThumbnailModel& thumbnailModel, DatabaseManager::getInstance().getThumbnailByDeviceAddress(address))
+        thumbnails.insert(QString("%1\n%2\n%3").arg(thumbnailModel.getName()).arg(thumbnailModel.getTimestamp()).arg(thumbnailModel.getSize()));
+
+    // Only thumbnails we don't have, or that changed on the server, are retrieved.
+    QList<ThumbnailModel> processModels;
+    foreach (const CasparThumbnail& thumbnailItem, thumbnailItems)
+    {
+        if (!thumbnails.contains(QString("%1\n%2\n%3").arg(thumbnailItem.getName()).arg(thumbnailItem.getTimestamp()).arg(thumbnailItem.getSize())))
+            processModels.push_back(ThumbnailModel(0, QByteArray(), thumbnailItem.getTimestamp(), thumbnailItem.getSize(),
+                                                   thumbnailItem.getName(), address));
+    }
+
+    emit thumbnailSynchronized(processModels);
+
+    qDebug() << QString("LibraryManager::deviceThumbnailChanged: %1 msec").arg(time.elapsed());
+}
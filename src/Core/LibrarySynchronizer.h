@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/CasparData.h"
+#include "Models/CasparMedia.h"
+#include "Models/CasparTemplate.h"
+#include "Models/CasparThumbnail.h"
+#include "Models/LibraryModel.h"
+#include "Models/ThumbnailModel.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+// Brings the library tables and the search index in line with the lists a server returned. Lives in the library thread, see
+// LibraryManager, and uses its own database connection there. Requests are handled in the order they
+// were queued, so the thumbnails of a refresh are compared after its media has been written.
+class CORE_EXPORT LibrarySynchronizer : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit LibrarySynchronizer(QObject* parent = 0);
+
+        // Rebuilds the search index from the database, at startup and when devices change.
+        Q_SLOT void loadIndex();
+        Q_SLOT void synchronizeMedia(const QString& address, const QList<CasparMedia>& mediaItems);
+        Q_SLOT void synchronizeTemplate(const QString& address, const QList<CasparTemplate>& templateItems);
+        Q_SLOT void synchronizeData(const QString& address, const QList<CasparData>& dataItems);
+        Q_SLOT void synchronizeThumbnail(const QString& address, const QList<CasparThumbnail>& thumbnailItems);
+
+        Q_SIGNAL void indexLoaded();
+        Q_SIGNAL void mediaSynchronized();
+        Q_SIGNAL void templateSynchronized();
+        Q_SIGNAL void dataSynchronized();
+        Q_SIGNAL void thumbnailSynchronized(const QList<ThumbnailModel>& processModels);
+
+    private:
+        static QHash<QString, int> indexByName(const QList<LibraryModel>& libraryModels);
+        static void findDeleted(const QList<LibraryModel>& libraryModels, const QVector<bool>& found, QList<LibraryModel>& deleteModels);
+};
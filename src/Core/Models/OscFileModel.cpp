@@ -1,7 +1,7 @@
 #include "OscFileModel.h"
 
 OscFileModel::OscFileModel()
-    : currentTime(0), totalTime(0), currentFrame(0), totalFrames(0), fps(0), path("")
+    : currentTime(0), totalTime(0), currentFrame(0), totalFrames(0), fps(0), path(""), paused(false), loop(false)
 {    
 }
 
@@ -64,3 +64,23 @@ void OscFileModel::setPath(const QString& path)
 {
     this->path = path;
 }
+
+bool OscFileModel::getPaused() const
+{
+    return this->paused;
+}
+
+void OscFileModel::setPaused(bool paused)
+{
+    this->paused = paused;
+}
+
+bool OscFileModel::getLoop() const
+{
+    return this->loop;
+}
+
+void OscFileModel::setLoop(bool loop)
+{
+    this->loop = loop;
+}
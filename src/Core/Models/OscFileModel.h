@@ -27,6 +27,12 @@ class CORE_EXPORT OscFileModel
         const QString& getPath() const;
         void setPath(const QString& path);
 
+        bool getPaused() const;
+        void setPaused(bool paused);
+
+        bool getLoop() const;
+        void setLoop(bool loop);
+
     private:
         double currentTime;
         double totalTime;
@@ -34,6 +40,8 @@ class CORE_EXPORT OscFileModel
         int totalFrames;
         int fps;
         QString path;
+        bool paused;
+        bool loop;
 };
 
 
@@ -1,6 +1,6 @@
 #include "ThumbnailModel.h"
 
-ThumbnailModel::ThumbnailModel(int id, const QString& data, const QString& timestamp, const QString& size, const QString& name, const QString& address)
+ThumbnailModel::ThumbnailModel(int id, const QByteArray& data, const QString& timestamp, const QString& size, const QString& name, const QString& address)
     : id(id), data(data), timestamp(timestamp), size(size), name(name), address(address)
 {
 }
@@ -10,7 +10,7 @@ int ThumbnailModel::getId() const
     return this->id;
 }
 
-const QString& ThumbnailModel::getData() const
+const QByteArray& ThumbnailModel::getData() const
 {
     return this->data;
 }
@@ -2,6 +2,7 @@
 
 #include "../Shared.h"
 
+#include <QtCore/QByteArray>
 #include <QtCore/QObject>
 #include <QtCore/QString>
 
@@ -9,10 +10,10 @@ class CORE_EXPORT ThumbnailModel
 {
     public:
         explicit ThumbnailModel() { }
-        explicit ThumbnailModel(int id, const QString& data, const QString& timestamp, const QString& size, const QString& name, const QString& address);
+        explicit ThumbnailModel(int id, const QByteArray& data, const QString& timestamp, const QString& size, const QString& name, const QString& address);
 
         int getId() const;
-        const QString& getData() const;
+        const QByteArray& getData() const; // PNG.
         const QString& getTimestamp() const;
         const QString& getSize() const;
         const QString& getName() const;
@@ -20,7 +21,7 @@ class CORE_EXPORT ThumbnailModel
 
     private:
         int id;
-        QString data;
+        QByteArray data;
         QString timestamp;
         QString size;
         QString name;
@@ -1,5 +1,6 @@
 #include "OscDeviceManager.h"
 #include "DatabaseManager.h"
+#include "OscSubscription.h"
 
 #include <stdexcept>
 
@@ -8,6 +9,7 @@
 Q_GLOBAL_STATIC(OscDeviceManager, oscDeviceManager)
 
 OscDeviceManager::OscDeviceManager()
+    : subscriptionCount(0), dispatchDepth(0), compactRoutes(false)
 {
 }
 
@@ -18,12 +20,36 @@ OscDeviceManager& OscDeviceManager::getInstance()
 
 void OscDeviceManager::initialize()
 {
-    this->oscSender = QSharedPointer<OscSender>();
+    this->oscSender = QSharedPointer<OscSender>(new OscSender());
 
+    QString oscBatchInterval = DatabaseManager::getInstance().getConfigurationByName("OscBatchInterval").getValue();
+    this->oscListener = QSharedPointer<OscListener>(new OscListener((oscBatchInterval.isEmpty() == true) ? Osc::DEFAULT_BATCH_INTERVAL : oscBatchInterval.toInt()));
+
+    QString oscControlRateLimit = DatabaseManager::getInstance().getConfigurationByName("OscControlRateLimit").getValue();
+    this->oscListener->setControlRateLimit((oscControlRateLimit.isEmpty() == true) ? Osc::DEFAULT_CONTROL_RATE_LIMIT : oscControlRateLimit.toInt());
+
+    // A comma separated list of ports, each optionally prefixed with the address to bind: 6250, 192.168.0.10:6251
     QString oscPort = DatabaseManager::getInstance().getConfigurationByName("OscPort").getValue();
-    this->oscListener = QSharedPointer<OscListener>(new OscListener("0.0.0.0", (oscPort.isEmpty() == true) ? Osc::DEFAULT_PORT : oscPort.toInt()));
+    if (oscPort.trimmed().isEmpty())
+        oscPort = QString("%1").arg(Osc::DEFAULT_PORT);
+
+    foreach (const QString& endpoint, oscPort.split(",", QString::SkipEmptyParts))
+    {
+        const int separator = endpoint.lastIndexOf(':');
+        if (separator < 0)
+            this->oscListener->addEndpoint("0.0.0.0", endpoint.trimmed().toInt());
+        else
+            this->oscListener->addEndpoint(endpoint.left(separator).trimmed(), endpoint.mid(separator + 1).trimmed().toInt());
+    }
+
     if (DatabaseManager::getInstance().getConfigurationByName("EnableOscInput").getValue() == "true")
         this->oscListener->start();
+
+    QObject::connect(this->oscListener.data(), SIGNAL(messageReceived(const QString&, const OscArguments&)),
+                     this, SLOT(dispatchMessage(const QString&, const OscArguments&)));
+    QObject::connect(&DatabaseManager::getInstance(), SIGNAL(configurationChanged(const QString&)), this, SLOT(configurationChanged(const QString&)));
+    QObject::connect(this->oscListener.data(), SIGNAL(controlReceived(const QString&, const OscArguments&, const QString&, int, bool)),
+                     this, SLOT(dispatchControl(const QString&, const OscArguments&, const QString&, int, bool)));
 }
 
 void OscDeviceManager::uninitialize()
@@ -39,3 +65,118 @@ const QSharedPointer<OscListener> OscDeviceManager::getOscListener() const
 {
     return this->oscListener;
 }
+
+void OscDeviceManager::addSubscription(OscSubscription* subscription)
+{
+    this->routes[subscription->getPath()].append(subscription);
+    this->subscriptionCount++;
+}
+
+void OscDeviceManager::removeSubscription(OscSubscription* subscription)
+{
+    QHash<QString, QList<OscSubscription*> >::iterator route = this->routes.find(subscription->getPath());
+    if (route == this->routes.end() || !route.value().contains(subscription))
+        return;
+
+    this->subscriptionCount--;
+
+    if (this->dispatchDepth > 0)
+    {
+        // A subscriber removed itself or another one while we are delivering, keep the indexes valid.
+        const int index = route.value().indexOf(subscription);
+        if (index >= 0)
+            route.value()[index] = NULL;
+
+        this->compactRoutes = true;
+        return;
+    }
+
+    route.value().removeOne(subscription);
+    if (route.value().isEmpty())
+        this->routes.erase(route);
+}
+
+int OscDeviceManager::getSubscriptionCount() const
+{
+    return this->subscriptionCount;
+}
+
+int OscDeviceManager::getRouteCount() const
+{
+    return this->routes.count();
+}
+
+void OscDeviceManager::configurationChanged(const QString& name)
+{
+    const QString value = DatabaseManager::getInstance().getConfigurationByName(name).getValue();
+    if (name == "OscBatchInterval")
+        this->oscListener->setBatchInterval((value.isEmpty() == true) ? Osc::DEFAULT_BATCH_INTERVAL : value.toInt());
+    else if (name == "OscControlRateLimit")
+        this->oscListener->setControlRateLimit((value.isEmpty() == true) ? Osc::DEFAULT_CONTROL_RATE_LIMIT : value.toInt());
+}
+
+int OscDeviceManager::dispatchMessage(const QString& path, const OscArguments& arguments)
+{
+    this->dispatchDepth++;
+
+    int delivered = dispatchRoute(path, arguments);
+
+    // Paths are "<host>/<address>", subscriptions without a host match the address from any sender.
+    const int slash = path.indexOf('/');
+    if (slash > 0)
+        delivered += dispatchRoute(path.mid(slash), arguments);
+
+    if (--this->dispatchDepth == 0 && this->compactRoutes)
+        compact();
+
+    return delivered;
+}
+
+void OscDeviceManager::dispatchControl(const QString& path, const OscArguments& arguments, const QString& replyAddress, int replyPort, bool accepted)
+{
+    const int delivered = accepted ? dispatchMessage(path, arguments) : 0;
+
+    // Tells the sender the command was run ("ok"), nothing listens to the path ("ignored")
+    // or it was refused by the rate limit ("busy"). The reply goes to the port the command came from.
+    const int slash = path.indexOf('/');
+    this->oscSender->send(replyAddress, replyPort, OscMessage("/ack").addString((slash > 0) ? path.mid(slash) : path)
+                                                                     .addString(!accepted ? "busy" : (delivered > 0) ? "ok" : "ignored")
+                                                                     .addInt32(delivered));
+}
+
+int OscDeviceManager::dispatchRoute(const QString& path, const OscArguments& arguments)
+{
+    int delivered = 0;
+
+    // Look the route up again for every subscriber, a subscriber may add routes while we deliver.
+    for (int i = 0; ; i++)
+    {
+        QHash<QString, QList<OscSubscription*> >::const_iterator route = this->routes.constFind(path);
+        if (route == this->routes.constEnd() || i >= route.value().count())
+            break;
+
+        OscSubscription* subscription = route.value().at(i);
+        if (subscription != NULL)
+        {
+            subscription->messageReceived(arguments);
+            delivered++;
+        }
+    }
+
+    return delivered;
+}
+
+void OscDeviceManager::compact()
+{
+    this->compactRoutes = false;
+
+    QHash<QString, QList<OscSubscription*> >::iterator route = this->routes.begin();
+    while (route != this->routes.end())
+    {
+        route.value().removeAll(NULL);
+        if (route.value().isEmpty())
+            route = this->routes.erase(route);
+        else
+            ++route;
+    }
+}
@@ -5,9 +5,13 @@
 #include "OscSender.h"
 #include "OscListener.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
 
+class OscSubscription;
+
 class CORE_EXPORT OscDeviceManager : public QObject
 {
     Q_OBJECT
@@ -23,8 +27,29 @@ class CORE_EXPORT OscDeviceManager : public QObject
         const QSharedPointer<OscSender> getOscSender() const;
         const QSharedPointer<OscListener> getOscListener() const;
 
+        // Subscriptions are routed by their exact path, "<host>/channel/1/..." for one server or
+        // "/control/..." for any sender, so a message only reaches the subscribers it is meant for.
+        void addSubscription(OscSubscription* subscription);
+        void removeSubscription(OscSubscription* subscription);
+
+        // Live subscriptions and the distinct paths they listen to, identical filters share one route.
+        int getSubscriptionCount() const;
+        int getRouteCount() const;
+
     private:
         QSharedPointer<OscSender> oscSender;
         QSharedPointer<OscListener> oscListener;
+
+        int subscriptionCount;
+        int dispatchDepth;
+        bool compactRoutes;
+        QHash<QString, QList<OscSubscription*> > routes;
+
+        int dispatchRoute(const QString& path, const OscArguments& arguments);
+        void compact();
+
+        Q_SLOT void configurationChanged(const QString& name);
+        Q_SLOT int dispatchMessage(const QString& path, const OscArguments& arguments);
+        Q_SLOT void dispatchControl(const QString& path, const OscArguments& arguments, const QString& replyAddress, int replyPort, bool accepted);
 };
 
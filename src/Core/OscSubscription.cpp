@@ -7,17 +7,21 @@
 OscSubscription::OscSubscription(const QString& path, QObject *parent)
     : QObject(parent),
       path(path)
-{  
-    QObject::connect(OscDeviceManager::getInstance().getOscListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+{
+    OscDeviceManager::getInstance().addSubscription(this);
+}
+
+OscSubscription::~OscSubscription()
+{
+    OscDeviceManager::getInstance().removeSubscription(this);
 }
 
-void OscSubscription::messageReceived(const QString& pattern, const QList<QVariant>& arguments)
+const QString& OscSubscription::getPath() const
 {
-    if (pattern.endsWith(this->path))
-    {
-        //qDebug() << "Found a subscriber: " << this->parent() << ":" << this->path;
+    return this->path;
+}
 
-        emit subscriptionReceived(this->path, arguments);
-    }
+void OscSubscription::messageReceived(const OscArguments& arguments)
+{
+    emit subscriptionReceived(this->path, arguments);
 }
@@ -2,11 +2,12 @@
 
 #include "Shared.h"
 
+#include "OscArguments.h"
+
 #include <QtCore/QList>
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QString>
-#include <QtCore/QVariant>
 
 class CORE_EXPORT OscSubscription : public QObject
 {
@@ -14,11 +15,16 @@ class CORE_EXPORT OscSubscription : public QObject
 
     public:
         explicit OscSubscription(const QString& path, QObject* parent = 0);
+        virtual ~OscSubscription();
+
+        const QString& getPath() const;
 
-        Q_SIGNAL void subscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SIGNAL void subscriptionReceived(const QString&, const OscArguments&);
 
     private:
         QString path;
 
-        Q_SLOT void messageReceived(const QString&, const QList<QVariant>&);
+        void messageReceived(const OscArguments& arguments);
+
+        friend class OscDeviceManager;
 };
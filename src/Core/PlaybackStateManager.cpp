@@ -0,0 +1,144 @@
+#include "PlaybackStateManager.h"
+#include "PlaybackStateSubscription.h"
+#include "OscSubscription.h"
+
+#include "Global.h"
+
+#include <QtCore/QDebug>
+
+Q_GLOBAL_STATIC(PlaybackStateManager, playbackStateManager)
+
+PlaybackStateManager::PlaybackStateManager()
+{
+    this->refreshTimer.setSingleShot(true);
+    QObject::connect(&this->refreshTimer, SIGNAL(timeout()), this, SLOT(refreshSubscriptions()));
+
+    this->lastRefresh.start();
+}
+
+PlaybackStateManager& PlaybackStateManager::getInstance()
+{
+    return *playbackStateManager();
+}
+
+QString PlaybackStateManager::getLayerKey(const QString& ipAddress, int channel, int videolayer)
+{
+    return QString("%1/channel/%2/stage/layer/%3").arg(ipAddress).arg(channel).arg(videolayer);
+}
+
+void PlaybackStateManager::addSubscription(PlaybackStateSubscription* subscription)
+{
+    PlaybackLayer*& layer = this->layers[subscription->getKey()];
+    if (layer == NULL)
+    {
+        layer = new PlaybackLayer();
+        layer->changed = false;
+
+        subscribeLayer(layer, subscription);
+    }
+
+    layer->subscriptions.append(subscription);
+}
+
+void PlaybackStateManager::removeSubscription(PlaybackStateSubscription* subscription)
+{
+    QHash<QString, PlaybackLayer*>::iterator layer = this->layers.find(subscription->getKey());
+    if (layer == this->layers.end())
+        return;
+
+    layer.value()->subscriptions.removeOne(subscription);
+    if (!layer.value()->subscriptions.isEmpty())
+        return;
+
+    // Nobody watches the layer anymore, stop listening to it.
+    qDeleteAll(layer.value()->oscSubscriptions);
+    delete layer.value();
+
+    this->layers.erase(layer);
+}
+
+void PlaybackStateManager::subscribeLayer(PlaybackLayer* layer, const PlaybackStateSubscription* subscription)
+{
+    QList<QString> filters;
+    filters << Osc::DEFAULT_TIME_FILTER << Osc::DEFAULT_FRAME_FILTER << Osc::DEFAULT_FPS_FILTER
+            << Osc::DEFAULT_PATH_FILTER << Osc::DEFAULT_PAUSED_FILTER << Osc::DEFAULT_LOOP_FILTER;
+
+    foreach (QString filter, filters)
+    {
+        filter.replace("#IPADDRESS#", subscription->getIpAddress())
+              .replace("#CHANNEL#", QString("%1").arg(subscription->getChannel()))
+              .replace("#VIDEOLAYER#", QString("%1").arg(subscription->getVideolayer()));
+
+        OscSubscription* oscSubscription = new OscSubscription(filter, this);
+        QObject::connect(oscSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                         this, SLOT(messageReceived(const QString&, const OscArguments&)));
+
+        layer->oscSubscriptions.append(oscSubscription);
+    }
+}
+
+void PlaybackStateManager::messageReceived(const QString& path, const OscArguments& arguments)
+{
+    // Path format: <ip>/channel/<channel>/stage/layer/<layer>/<property>
+    const int propertyBegin = path.indexOf('/', path.indexOf("/stage/layer/") + 13);
+    const QString key = path.left(propertyBegin);
+
+    PlaybackLayer* layer = this->layers.value(key);
+    if (layer == NULL || arguments.isEmpty())
+        return;
+
+    const QString property = path.mid(propertyBegin);
+    if (property == "/file/time" && arguments.count() > 1)
+    {
+        layer->state.setTime(arguments.at(0).toDouble());
+        layer->state.setTotalTime(arguments.at(1).toDouble());
+    }
+    else if (property == "/file/frame" && arguments.count() > 1)
+    {
+        layer->state.setFrame(arguments.at(0).toInt());
+        layer->state.setTotalFrames(arguments.at(1).toInt());
+    }
+    else if (property == "/file/fps")
+        layer->state.setFramesPerSecond(arguments.at(0).toInt());
+    else if (property == "/file/path")
+        layer->state.setPath(arguments.at(0).toString());
+    else if (property == "/paused")
+        layer->state.setPaused(arguments.at(0).toBool());
+    else if (property == "/loop")
+        layer->state.setLoop(arguments.at(0).toBool());
+
+    if (!layer->changed)
+    {
+        layer->changed = true;
+        this->changedLayers.append(key);
+    }
+
+    if (!this->refreshTimer.isActive())
+        this->refreshTimer.start(qMax(0, PlaybackStateManager::REFRESH_INTERVAL - static_cast<int>(this->lastRefresh.elapsed())));
+}
+
+void PlaybackStateManager::refreshSubscriptions()
+{
+    this->lastRefresh.restart();
+
+    QList<QString> keys;
+    keys.swap(this->changedLayers);
+
+    foreach (const QString& key, keys)
+    {
+        PlaybackLayer* layer = this->layers.value(key);
+        if (layer == NULL)
+            continue; // Unsubscribed since it changed.
+
+        layer->changed = false;
+
+        // Subscribers may unsubscribe, or the layer go away, while we notify.
+        const OscFileModel state = layer->state;
+        const QList<PlaybackStateSubscription*> subscriptions = layer->subscriptions;
+        foreach (PlaybackStateSubscription* subscription, subscriptions)
+        {
+            if (this->layers.value(key) == layer && layer->subscriptions.contains(subscription))
+                subscription->stateChanged(state);
+        }
+    }
+}
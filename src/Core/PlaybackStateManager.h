@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "OscArguments.h"
+
+#include "Models/OscFileModel.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+class OscSubscription;
+class PlaybackStateSubscription;
+
+// Holds the latest playback state (time, frame, fps, path, paused, loop) of every layer somebody watches,
+// keyed by server, channel and layer. The layer is subscribed to over OSC once, however many rundown items
+// watch it, and the subscribers are notified at most once per REFRESH_INTERVAL however often the server reports.
+class CORE_EXPORT PlaybackStateManager : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit PlaybackStateManager();
+
+        static PlaybackStateManager& getInstance();
+
+        static QString getLayerKey(const QString& ipAddress, int channel, int videolayer);
+
+        void addSubscription(PlaybackStateSubscription* subscription);
+        void removeSubscription(PlaybackStateSubscription* subscription);
+
+    private:
+        static const int REFRESH_INTERVAL = 40;
+
+        struct PlaybackLayer
+        {
+            OscFileModel state;
+            bool changed;
+            QList<OscSubscription*> oscSubscriptions;
+            QList<PlaybackStateSubscription*> subscriptions;
+        };
+
+        QHash<QString, PlaybackLayer*> layers;
+        QList<QString> changedLayers;
+        QTimer refreshTimer;
+        QElapsedTimer lastRefresh;
+
+        void subscribeLayer(PlaybackLayer* layer, const PlaybackStateSubscription* subscription);
+
+        Q_SLOT void messageReceived(const QString& path, const OscArguments& arguments);
+        Q_SLOT void refreshSubscriptions();
+};
@@ -0,0 +1,39 @@
+#include "PlaybackStateSubscription.h"
+#include "PlaybackStateManager.h"
+
+PlaybackStateSubscription::PlaybackStateSubscription(const QString& ipAddress, int channel, int videolayer, QObject* parent)
+    : QObject(parent),
+      key(PlaybackStateManager::getLayerKey(ipAddress, channel, videolayer)), ipAddress(ipAddress), channel(channel), videolayer(videolayer)
+{
+    PlaybackStateManager::getInstance().addSubscription(this);
+}
+
+PlaybackStateSubscription::~PlaybackStateSubscription()
+{
+    PlaybackStateManager::getInstance().removeSubscription(this);
+}
+
+const QString& PlaybackStateSubscription::getKey() const
+{
+    return this->key;
+}
+
+const QString& PlaybackStateSubscription::getIpAddress() const
+{
+    return this->ipAddress;
+}
+
+int PlaybackStateSubscription::getChannel() const
+{
+    return this->channel;
+}
+
+int PlaybackStateSubscription::getVideolayer() const
+{
+    return this->videolayer;
+}
+
+void PlaybackStateSubscription::stateChanged(const OscFileModel& state)
+{
+    emit playbackStateChanged(state);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/OscFileModel.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+class CORE_EXPORT PlaybackStateSubscription : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit PlaybackStateSubscription(const QString& ipAddress, int channel, int videolayer, QObject* parent = 0);
+        virtual ~PlaybackStateSubscription();
+
+        const QString& getKey() const;
+        const QString& getIpAddress() const;
+        int getChannel() const;
+        int getVideolayer() const;
+
+        Q_SIGNAL void playbackStateChanged(const OscFileModel&);
+
+    private:
+        QString key;
+        QString ipAddress;
+        int channel;
+        int videolayer;
+
+        void stateChanged(const OscFileModel& state);
+
+        friend class PlaybackStateManager;
+};
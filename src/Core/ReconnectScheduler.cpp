@@ -0,0 +1,172 @@
+#include "ReconnectScheduler.h"
+
+#include <QtCore/QtGlobal>
+#include <QtCore/QMetaObject>
+
+Q_GLOBAL_STATIC(ReconnectScheduler, reconnectScheduler)
+
+ReconnectScheduler::ReconnectScheduler(QObject* parent)
+    : QObject(parent),
+      cursor(0), scheduled(0), wheel(ReconnectScheduler::WHEEL_SIZE)
+{
+    qsrand(QDateTime::currentDateTime().toTime_t());
+
+    this->timer.setInterval(ReconnectScheduler::TICK_INTERVAL);
+    QObject::connect(&this->timer, SIGNAL(timeout()), this, SLOT(tick()));
+}
+
+ReconnectScheduler& ReconnectScheduler::getInstance()
+{
+    return *reconnectScheduler();
+}
+
+void ReconnectScheduler::addDevice(QObject* device)
+{
+    if (this->entries.contains(device))
+        return;
+
+    ReconnectStatistics statistics = { 0, 0, 0, 0, 0, 0, QDateTime(), QDateTime() };
+    ReconnectEntry entry = { ReconnectScheduler::Waiting, -1, 0, statistics };
+
+    // Spread the first attempts of all devices over the first second.
+    ReconnectEntry& inserted = this->entries.insert(device, entry).value();
+    schedule(device, inserted, qrand() % ReconnectScheduler::BASE_DELAY);
+}
+
+void ReconnectScheduler::removeDevice(QObject* device)
+{
+    if (!this->entries.contains(device))
+        return;
+
+    unschedule(device, this->entries[device]);
+    this->entries.remove(device);
+}
+
+void ReconnectScheduler::setConnected(QObject* device, bool connected)
+{
+    if (!this->entries.contains(device))
+        return;
+
+    ReconnectEntry& entry = this->entries[device];
+    if (connected)
+    {
+        unschedule(device, entry);
+
+        entry.state = ReconnectScheduler::Connected;
+        entry.statistics.connects++;
+        entry.statistics.failures = 0;
+        entry.statistics.delay = 0;
+        entry.statistics.lastConnected = QDateTime::currentDateTime();
+    }
+    else if (entry.state == ReconnectScheduler::Connected)
+    {
+        entry.statistics.disconnects++;
+
+        scheduleRetry(device, entry);
+    }
+    else if (entry.state == ReconnectScheduler::Connecting)
+    {
+        // The attempt failed before the timeout did.
+        unschedule(device, entry);
+
+        entry.statistics.failures++;
+
+        scheduleRetry(device, entry);
+    }
+}
+
+const ReconnectScheduler::ReconnectStatistics ReconnectScheduler::getStatistics(QObject* device) const
+{
+    if (!this->entries.contains(device))
+    {
+        ReconnectStatistics statistics = { 0, 0, 0, 0, 0, 0, QDateTime(), QDateTime() };
+        return statistics;
+    }
+
+    return this->entries.value(device).statistics;
+}
+
+void ReconnectScheduler::scheduleRetry(QObject* device, ReconnectEntry& entry)
+{
+    int delay = ReconnectScheduler::BASE_DELAY << qMin(entry.statistics.failures, 6);
+    delay = qMin(delay, static_cast<int>(ReconnectScheduler::MAX_DELAY));
+
+    // Equal jitter, wait at least half of the delay.
+    delay = delay / 2 + qrand() % (delay / 2 + 1);
+
+    entry.state = ReconnectScheduler::Waiting;
+    entry.statistics.delay = delay;
+
+    schedule(device, entry, delay);
+}
+
+void ReconnectScheduler::schedule(QObject* device, ReconnectEntry& entry, int delay)
+{
+    const int ticks = qMax(1, (delay + ReconnectScheduler::TICK_INTERVAL - 1) / ReconnectScheduler::TICK_INTERVAL);
+
+    entry.slot = (this->cursor + ticks) % ReconnectScheduler::WHEEL_SIZE;
+    entry.rounds = (ticks - 1) / ReconnectScheduler::WHEEL_SIZE;
+
+    this->wheel[entry.slot].append(device);
+    if (this->scheduled++ == 0)
+        this->timer.start();
+}
+
+void ReconnectScheduler::unschedule(QObject* device, ReconnectEntry& entry)
+{
+    if (entry.slot < 0)
+        return;
+
+    this->wheel[entry.slot].removeOne(device);
+    entry.slot = -1;
+
+    if (--this->scheduled == 0)
+        this->timer.stop();
+}
+
+void ReconnectScheduler::tick()
+{
+    this->cursor = (this->cursor + 1) % ReconnectScheduler::WHEEL_SIZE;
+
+    QList<QObject*> due;
+    QList<QObject*>& slot = this->wheel[this->cursor];
+    for (int i = slot.count() - 1; i >= 0; i--)
+    {
+        ReconnectEntry& entry = this->entries[slot.at(i)];
+        if (entry.rounds > 0)
+        {
+            entry.rounds--;
+            continue;
+        }
+
+        due.append(slot.takeAt(i));
+        entry.slot = -1;
+
+        this->scheduled--;
+    }
+
+    foreach (QObject* device, due)
+    {
+        ReconnectEntry& entry = this->entries[device];
+        if (entry.state == ReconnectScheduler::Waiting)
+        {
+            entry.state = ReconnectScheduler::Connecting;
+            entry.statistics.attempts++;
+            entry.statistics.lastAttempt = QDateTime::currentDateTime();
+
+            schedule(device, entry, ReconnectScheduler::CONNECT_TIMEOUT);
+
+            QMetaObject::invokeMethod(device, "connectDevice");
+        }
+        else if (entry.state == ReconnectScheduler::Connecting)
+        {
+            entry.statistics.timeouts++;
+            entry.statistics.failures++;
+
+            scheduleRetry(device, entry);
+        }
+    }
+
+    if (this->scheduled == 0)
+        this->timer.stop();
+}
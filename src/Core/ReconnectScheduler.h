@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+// Reconnects all devices (servers and switchers) from a single timer wheel. Every failed attempt doubles
+// the delay up to MAX_DELAY, with random jitter so devices that dropped together do not retry together.
+// An attempt that has not connected within CONNECT_TIMEOUT counts as a failure. Devices are driven
+// through their connectDevice() slot, the device managers report connection state changes back.
+class CORE_EXPORT ReconnectScheduler : public QObject
+{
+    Q_OBJECT
+
+    public:
+        struct ReconnectStatistics
+        {
+            int attempts;
+            int timeouts;
+            int connects;
+            int disconnects;
+            int failures; // Consecutive failed attempts, reset when connected.
+            int delay; // Milliseconds until the next attempt.
+            QDateTime lastAttempt;
+            QDateTime lastConnected;
+        };
+
+        explicit ReconnectScheduler(QObject* parent = 0);
+
+        static ReconnectScheduler& getInstance();
+
+        void addDevice(QObject* device);
+        void removeDevice(QObject* device);
+        void setConnected(QObject* device, bool connected);
+
+        const ReconnectStatistics getStatistics(QObject* device) const;
+
+    private:
+        enum ReconnectState
+        {
+            Waiting,
+            Connecting,
+            Connected
+        };
+
+        struct ReconnectEntry
+        {
+            ReconnectState state;
+            int slot;
+            int rounds;
+            ReconnectStatistics statistics;
+        };
+
+        static const int TICK_INTERVAL = 250;
+        static const int WHEEL_SIZE = 64;
+        static const int BASE_DELAY = 1000;
+        static const int MAX_DELAY = 60000;
+        static const int CONNECT_TIMEOUT = 5000;
+
+        QTimer timer;
+        int cursor;
+        int scheduled;
+        QVector<QList<QObject*> > wheel;
+        QMap<QObject*, ReconnectEntry> entries;
+
+        void schedule(QObject* device, ReconnectEntry& entry, int delay);
+        void unschedule(QObject* device, ReconnectEntry& entry);
+        void scheduleRetry(QObject* device, ReconnectEntry& entry);
+
+        Q_SLOT void tick();
+};
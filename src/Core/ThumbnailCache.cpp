@@ -0,0 +1,145 @@
+#include "ThumbnailCache.h"
+#include "DatabaseManager.h"
+
+#include "Global.h"
+
+#include <QtCore/QMetaObject>
+#include <QtCore/QMetaType>
+#include <QtCore/QRunnable>
+#include <QtCore/QThread>
+
+#include <QtGui/QColor>
+
+Q_GLOBAL_STATIC(ThumbnailCache, thumbnailCache)
+
+// Reads one thumbnail from the database and decodes it in both sizes, off the GUI thread.
+class ThumbnailDecodeTask : public QRunnable
+{
+    public:
+        explicit ThumbnailDecodeTask(ThumbnailCache* cache, const QString& key, int generation, const QString& name, const QString& deviceName)
+            : cache(cache), key(key), generation(generation), name(name), deviceName(deviceName)
+        {
+        }
+
+        virtual void run()
+        {
+            const QByteArray data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->name, this->deviceName).getData();
+
+            QImage image;
+            QImage compactImage;
+            if (!data.isEmpty() && image.loadFromData(data, "PNG"))
+            {
+                // The labels are exactly these sizes, scaling once here saves scaling on every paint.
+                compactImage = image.scaled(Rundown::COMPACT_THUMBNAIL_WIDTH, Rundown::COMPACT_THUMBNAIL_HEIGHT, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+                image = image.scaled(Rundown::DEFAULT_THUMBNAIL_WIDTH, Rundown::DEFAULT_THUMBNAIL_HEIGHT, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+            }
+
+            QMetaObject::invokeMethod(this->cache, "thumbnailDecoded", Qt::QueuedConnection, Q_ARG(QString, this->key), Q_ARG(int, this->generation),
+                                      Q_ARG(QByteArray, data), Q_ARG(QImage, image), Q_ARG(QImage, compactImage));
+        }
+
+    private:
+        ThumbnailCache* cache;
+        QString key;
+        int generation;
+        QString name;
+        QString deviceName;
+};
+
+ThumbnailCache::ThumbnailCache(QObject* parent)
+    : QObject(parent),
+      entries(ThumbnailCache::CACHE_SIZE)
+{
+    qRegisterMetaType<QImage>("QImage");
+
+    // Every worker opens its own database connection, keep the threads instead of letting them expire.
+    this->pool.setExpiryTimeout(-1);
+    this->pool.setMaxThreadCount(qMax(2, QThread::idealThreadCount()));
+
+    this->placeholder = QPixmap(Rundown::DEFAULT_THUMBNAIL_WIDTH, Rundown::DEFAULT_THUMBNAIL_HEIGHT);
+    this->placeholder.fill(QColor(Color::DEFAULT_THUMBNAIL_COLOR));
+
+    this->compactPlaceholder = QPixmap(Rundown::COMPACT_THUMBNAIL_WIDTH, Rundown::COMPACT_THUMBNAIL_HEIGHT);
+    this->compactPlaceholder.fill(QColor(Color::DEFAULT_THUMBNAIL_COLOR));
+}
+
+ThumbnailCache::~ThumbnailCache()
+{
+    // The tasks call back into this object.
+    this->pool.waitForDone();
+}
+
+ThumbnailCache& ThumbnailCache::getInstance()
+{
+    return *thumbnailCache();
+}
+
+QString ThumbnailCache::getKey(const QString& name, const QString& deviceName)
+{
+    return QString("%1\n%2").arg(deviceName).arg(name);
+}
+
+bool ThumbnailCache::getThumbnail(const QString& name, const QString& deviceName, bool compact, QPixmap& pixmap, QByteArray& data,
+                                  QObject* receiver, const char* member)
+{
+    const QString key = getKey(name, deviceName);
+
+    const ThumbnailEntry* entry = this->entries.object(key);
+    if (entry != NULL)
+    {
+        pixmap = compact ? entry->compactPixmap : entry->pixmap;
+        data = entry->data;
+
+        return true;
+    }
+
+    // Items for the same clip wait for the same decode.
+    const bool pending = this->pendingReceivers.contains(key);
+    this->pendingReceivers[key].push_back(qMakePair(QPointer<QObject>(receiver), QByteArray(member)));
+
+    if (!pending)
+        this->pool.start(new ThumbnailDecodeTask(this, key, this->generations.value(key), name, deviceName));
+
+    return false;
+}
+
+QPixmap ThumbnailCache::getPlaceholder(bool compact)
+{
+    return compact ? this->compactPlaceholder : this->placeholder;
+}
+
+void ThumbnailCache::removeThumbnail(const QString& name, const QString& deviceName)
+{
+    const QString key = getKey(name, deviceName);
+    this->entries.remove(key);
+
+    // A decode that is still running read the previous thumbnail. Its result is dropped when it arrives,
+    // the receivers keep waiting for a new decode.
+    if (this->pendingReceivers.contains(key))
+        this->pool.start(new ThumbnailDecodeTask(this, key, ++this->generations[key], name, deviceName));
+}
+
+void ThumbnailCache::thumbnailDecoded(const QString& key, int generation, const QByteArray& data, const QImage& image, const QImage& compactImage)
+{
+    if (generation != this->generations.value(key))
+        return;
+
+    ThumbnailEntry* entry = new ThumbnailEntry();
+    if (!image.isNull())
+    {
+        entry->pixmap = QPixmap::fromImage(image);
+        entry->compactPixmap = QPixmap::fromImage(compactImage);
+        entry->data = data;
+    }
+
+    // Clips without a thumbnail are cached too, so they aren't looked up again for every item.
+    const int cost = qMax(1, image.byteCount() + compactImage.byteCount() + data.size());
+    this->entries.insert(key, entry, cost);
+
+    const QList<QPair<QPointer<QObject>, QByteArray> > receivers = this->pendingReceivers.take(key);
+    for (int i = 0; i < receivers.count(); i++)
+    {
+        if (!receivers.at(i).first.isNull())
+            QMetaObject::invokeMethod(receivers.at(i).first, receivers.at(i).second.constData(), Qt::DirectConnection);
+    }
+}
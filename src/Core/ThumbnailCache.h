@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCache>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QPair>
+#include <QtCore/QPointer>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+
+#include <QtGui/QImage>
+#include <QtGui/QPixmap>
+
+// Decoded thumbnails shared by the rundown items, in the two sizes they are shown in. Items for the same clip
+// share one entry, the least recently used entries are evicted once the pixmaps and PNG data take more than
+// CACHE_SIZE bytes. A miss reads, decodes and scales the thumbnail on a worker pool, the caller shows a
+// placeholder meanwhile and is called back on the GUI thread when the thumbnail is ready.
+class CORE_EXPORT ThumbnailCache : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit ThumbnailCache(QObject* parent = 0);
+        ~ThumbnailCache();
+
+        static ThumbnailCache& getInstance();
+
+        // True when the thumbnail is cached (pixmap is null when the clip has none). Otherwise the method
+        // named member, a slot without arguments, is invoked on the receiver once it has been decoded.
+        bool getThumbnail(const QString& name, const QString& deviceName, bool compact, QPixmap& pixmap, QByteArray& data,
+                          QObject* receiver, const char* member);
+        QPixmap getPlaceholder(bool compact);
+
+        // Called when a new thumbnail has been stored for the clip.
+        void removeThumbnail(const QString& name, const QString& deviceName);
+
+    private:
+        struct ThumbnailEntry
+        {
+            QPixmap pixmap;
+            QPixmap compactPixmap;
+            QByteArray data; // PNG, for the tooltips.
+        };
+
+        static const int CACHE_SIZE = 33554432; // Bytes.
+
+        QThreadPool pool;
+        QCache<QString, ThumbnailEntry> entries;
+        QHash<QString, QList<QPair<QPointer<QObject>, QByteArray> > > pendingReceivers;
+        QHash<QString, int> generations; // Bumped when a thumbnail is replaced while it is being decoded.
+        QPixmap placeholder;
+        QPixmap compactPlaceholder;
+
+        static QString getKey(const QString& name, const QString& deviceName);
+
+        Q_SLOT void thumbnailDecoded(const QString& key, int generation, const QByteArray& data, const QImage& image, const QImage& compactImage);
+};
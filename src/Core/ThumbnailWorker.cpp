@@ -1,6 +1,7 @@
 #include "ThumbnailWorker.h"
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
+#include "ThumbnailCache.h"
 #include "EventManager.h"
 #include "Events/MediaChangedEvent.h"
 #include "Events/StatusbarEvent.h"
@@ -9,7 +10,7 @@
 
 #include "CasparDevice.h"
 
-#include <QtCore/QTimer>
+#include <QtCore/QDebug>
 
 #include <QtGui/QApplication>
 
@@ -17,54 +18,84 @@ ThumbnailWorker::ThumbnailWorker(const QList<ThumbnailModel>& thumbnailModels, Q
     : QObject(parent),
       thumbnailModels(thumbnailModels)
 {
-    QObject::connect(&this->thumbnailTimer, SIGNAL(timeout()), this, SLOT(process()));
 }
 
 void ThumbnailWorker::start()
 {
-    this->thumbnailTimer.setInterval(2000); // Settings?
-    this->thumbnailTimer.start();
+    if (this->thumbnailModels.count() == 0)
+        return;
+
+    const DeviceModel& model = DeviceManager::getInstance().getDeviceModelByAddress(this->thumbnailModels.at(0).getAddress());
+    if (model.getShadow() == "Yes")
+        return;
+
+    this->device = DeviceManager::getInstance().getDeviceByName(model.getName());
+    if (this->device == NULL)
+        return;
+
+    QObject::connect(this->device.data(), SIGNAL(commandCompleted(int, int, qint64)), this, SLOT(commandCompleted(int, int, qint64)));
+    QObject::connect(this->device.data(), SIGNAL(thumbnailRetrieveChanged(const QString&, int, CasparDevice&)), this, SLOT(thumbnailRetrieveChanged(const QString&, int, CasparDevice&)));
+
+    process();
 }
 
 void ThumbnailWorker::process()
 {
-    if (this->thumbnailModels.count() == 0)
+    if (!this->device->isConnected())
     {
-        this->thumbnailTimer.stop();
-        EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
+        this->thumbnailModels.clear();
+        this->pendingModels.clear();
 
-        return;
-    }
-
-    this->currentName = this->thumbnailModels.at(0).getName();
-    this->currentAddress = this->thumbnailModels.at(0).getAddress();
-    this->currentTimestamp= this->thumbnailModels.at(0).getTimestamp();
-    this->currentSize= this->thumbnailModels.at(0).getSize();
+        finish();
 
-    const DeviceModel& model = DeviceManager::getInstance().getDeviceModelByAddress(this->currentAddress);
-    if (model.getShadow() == "Yes")
         return;
+    }
 
-    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(model.getName());
-    if (!device->isConnected())
+    // Keep a few retrieves in flight on the connection, the replies are matched back by ticket.
+    while (this->pendingModels.count() < ThumbnailWorker::MAX_PENDING_RETRIEVES && this->thumbnailModels.count() > 0)
     {
-        this->thumbnailTimer.stop();
-        EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
+        const ThumbnailModel model = this->thumbnailModels.takeFirst();
 
-        return;
+        EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(QString("Retrieving thumbnail %1...").arg(model.getName())));
+        qDebug() << QString("ThumbnailWorker::process: Retrieving thumbnail %1").arg(model.getName());
+
+        int ticket = this->device->retrieveThumbnail(model.getName());
+        if (ticket > 0)
+            this->pendingModels.insert(ticket, model);
     }
 
-    EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(QString("Retrieving thumbnail %1...").arg(this->currentName)));
-    qDebug() << QString("ThumbnailWorker::process: Retrieving thumbnail %1").arg(this->currentName);
+    if (this->pendingModels.count() == 0)
+        finish();
+}
 
-    QObject::connect(device.data(), SIGNAL(thumbnailRetrieveChanged(const QString&, CasparDevice&)), this, SLOT(thumbnailRetrieveChanged(const QString&, CasparDevice&)));
-    device->retrieveThumbnail(this->currentName);
+void ThumbnailWorker::finish()
+{
+    QObject::disconnect(this->device.data(), 0, this, 0);
 
-    this->thumbnailModels.removeAt(0);
+    EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
 }
 
-void ThumbnailWorker::thumbnailRetrieveChanged(const QString& data, CasparDevice& device)
+void ThumbnailWorker::thumbnailRetrieveChanged(const QString& data, int ticket, CasparDevice& device)
 {
-    QObject::disconnect(&device, SIGNAL(thumbnailRetrieveChanged(const QString&, CasparDevice&)), this, SLOT(thumbnailRetrieveChanged(const QString&, CasparDevice&)));
-    DatabaseManager::getInstance().updateThumbnail(ThumbnailModel(0, data, this->currentTimestamp, this->currentSize, this->currentName, this->currentAddress));
+    Q_UNUSED(device);
+
+    if (!this->pendingModels.contains(ticket))
+        return; // Not one of ours.
+
+    const ThumbnailModel& model = this->pendingModels.value(ticket);
+    DatabaseManager::getInstance().updateThumbnail(ThumbnailModel(0, QByteArray::fromBase64(data.toAscii()), model.getTimestamp(), model.getSize(), model.getName(), model.getAddress()));
+
+    // Decoded again by the rundown the next time it is shown.
+    ThumbnailCache::getInstance().removeThumbnail(model.getName(), DeviceManager::getInstance().getDeviceModelByAddress(model.getAddress()).getName());
+}
+
+void ThumbnailWorker::commandCompleted(int ticket, int code, qint64 latency)
+{
+    Q_UNUSED(code);
+    Q_UNUSED(latency);
+
+    if (this->pendingModels.remove(ticket) == 0)
+        return; // Not one of ours.
+
+    process();
 }
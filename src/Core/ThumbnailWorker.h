@@ -10,8 +10,9 @@
 
 #include "Models/ThumbnailModel.h"
 
+#include <QtCore/QMap>
 #include <QtCore/QObject>
-#include <QtCore/QTimer>
+#include <QtCore/QSharedPointer>
 
 class CORE_EXPORT ThumbnailWorker : public QObject
 {
@@ -23,15 +24,16 @@ class CORE_EXPORT ThumbnailWorker : public QObject
         void start();
 
     private:
-        QTimer thumbnailTimer;
+        static const int MAX_PENDING_RETRIEVES = 8;
 
-        QString currentName;
-        QString currentTimestamp;
-        QString currentSize;
-        QString currentAddress;
+        QSharedPointer<CasparDevice> device;
 
         QList<ThumbnailModel> thumbnailModels;
+        QMap<int, ThumbnailModel> pendingModels;
 
-        Q_SLOT void process();
-        Q_SLOT void thumbnailRetrieveChanged(const QString& data, CasparDevice& device);
+        void process();
+        void finish();
+
+        Q_SLOT void commandCompleted(int ticket, int code, qint64 latency);
+        Q_SLOT void thumbnailRetrieveChanged(const QString& data, int ticket, CasparDevice& device);
 };
@@ -1,5 +1,6 @@
 #include "TriCasterDeviceManager.h"
 #include "DatabaseManager.h"
+#include "ReconnectScheduler.h"
 #include "Events/ConnectionStateChangedEvent.h"
 #include "Models/TriCaster/TriCasterDeviceModel.h"
 
@@ -35,7 +36,8 @@ void TriCasterDeviceManager::initialize()
 
         emit deviceAdded(*device);
 
-        device->connectDevice();
+        QObject::connect(device.data(), SIGNAL(connectionStateChanged(TriCasterDevice&)), this, SLOT(deviceConnectionStateChanged(TriCasterDevice&)));
+        ReconnectScheduler::getInstance().addDevice(device.data());
     }
 }
 
@@ -44,6 +46,8 @@ void TriCasterDeviceManager::uninitialize()
     foreach (const QString& key, this->devices.keys())
     {
         QSharedPointer<TriCasterDevice>& device = this->devices[key];
+
+        ReconnectScheduler::getInstance().removeDevice(device.data());
         device->disconnectDevice();
     }
 }
@@ -69,6 +73,7 @@ void TriCasterDeviceManager::refresh()
 
         if (!foundDevice)
         {
+            ReconnectScheduler::getInstance().removeDevice(device.data());
             device->disconnectDevice();
 
             this->devices.remove(key);
@@ -90,7 +95,8 @@ void TriCasterDeviceManager::refresh()
 
             emit deviceAdded(*device);
 
-            device->connectDevice();
+            QObject::connect(device.data(), SIGNAL(connectionStateChanged(TriCasterDevice&)), this, SLOT(deviceConnectionStateChanged(TriCasterDevice&)));
+            ReconnectScheduler::getInstance().addDevice(device.data());
         }
     }
 }
@@ -135,3 +141,8 @@ const QSharedPointer<TriCasterDevice> TriCasterDeviceManager::getDeviceByName(co
 {
     return this->devices.value(name);
 }
+
+void TriCasterDeviceManager::deviceConnectionStateChanged(TriCasterDevice& device)
+{
+    ReconnectScheduler::getInstance().setConnected(&device, device.isConnected());
+}
@@ -37,5 +37,7 @@ class CORE_EXPORT TriCasterDeviceManager : public QObject
     private:
         QMap<QString, TriCasterDeviceModel> deviceModels;
         QMap<QString, QSharedPointer<TriCasterDevice> > devices;
+
+        Q_SLOT void deviceConnectionStateChanged(TriCasterDevice& device);
 };
 
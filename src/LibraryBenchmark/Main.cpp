@@ -0,0 +1,543 @@
+#include "DatabaseManager.h"
+#include "LibraryIndex.h"
+#include "ThumbnailCache.h"
+#include "ThumbnailCounter.h"
+
+#include "Global.h"
+
+#include "Models/ConfigurationModel.h"
+#include "Models/DeviceModel.h"
+#include "Models/FormatModel.h"
+#include "Models/LibraryModel.h"
+#include "Models/ThumbnailModel.h"
+
+#include <QtCore/QBuffer>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+#include <QtCore/QVector>
+#include <QtCore/QtAlgorithms>
+
+#include <QtSql/QSqlDatabase>
+#include <QtSql/QSqlQuery>
+
+#include <QtGui/QApplication>
+#include <QtGui/QImage>
+#include <QtGui/QPixmap>
+
+struct BenchmarkOptions
+{
+    int rows;
+    int devices;
+    int iterations;
+};
+
+struct FilterCase
+{
+    const char* description;
+    QString filter;
+    QList<QString> devices;
+};
+
+void printUsage(QTextStream& stream)
+{
+    stream << "Usage: librarybenchmark [-rows 100000] [-devices 4] [-iterations 10]" << endl
+           << endl
+           << "Creates a temporary database with -rows media clips spread over -devices servers, then times" << endl
+           << "DatabaseManager against it. A few names contain quotes, the way real clip names do." << endl
+           << "The filters are timed against LibraryIndex as well, use -rows 200000 for the size of a large installation." << endl
+           << "The reads a rundown item makes are timed through the cache and with an SQL query per read." << endl
+           << "Selecting a clip with a thumbnail is timed with the PNG stored as a blob and as base64 text." << endl
+           << "Opening a rundown is timed with and without ThumbnailCache, which needs a display." << endl;
+}
+
+static const char* const MEDIA_TYPES[] = { "MOVIE", "STILL", "AUDIO" };
+
+QString getAddress(int device)
+{
+    return QString("10.0.0.%1").arg(device + 1);
+}
+
+QString formatTime(qint64 nanoseconds)
+{
+    return QString("%1 ms").arg(nanoseconds / 1000000.0, 0, 'f', 2);
+}
+
+qint64 getMedian(QVector<qint64> samples)
+{
+    qSort(samples);
+
+    return samples.at(samples.count() / 2);
+}
+
+// Clip names the way a server lists them, in folders, with every 1000th name containing a quote.
+QList<LibraryModel> createMedia(int first, int count)
+{
+    QList<LibraryModel> models;
+    models.reserve(count);
+
+    for (int i = first; i < first + count; i++)
+    {
+        const QString name = (i % 1000 == 0) ? QString("INTERVIEWS/O'BRIEN_%1").arg(i) :
+                                               QString("FOLDER%1/CLIP_%2").arg(i % 100).arg(i, 7, 10, QChar('0'));
+
+        models.push_back(LibraryModel(0, name, name, QString(), MEDIA_TYPES[i % 3], 0, "00:00:10:00"));
+    }
+
+    return models;
+}
+
+int countMedia(const BenchmarkOptions& options)
+{
+    int count = 0;
+    for (int device = 0; device < options.devices; device++)
+        count += DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(getAddress(device)).count();
+
+    return count;
+}
+
+// The initial synchronization of every server, followed by the diffs a refresh writes: 1% of the
+// clips deleted, as many added and another 1% with a new timecode.
+bool benchmarkUpdateLibraryMedia(const BenchmarkOptions& options, QTextStream& stream)
+{
+    const int rowsPerDevice = options.rows / options.devices;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int device = 0; device < options.devices; device++)
+        DatabaseManager::getInstance().updateLibraryMedia(getAddress(device), QList<LibraryModel>(), createMedia(device * rowsPerDevice, rowsPerDevice),
+                                                          QList<LibraryModel>());
+
+    stream << QString("updateLibraryMedia, insert %1 rows: %2").arg(rowsPerDevice * options.devices).arg(formatTime(timer.nsecsElapsed())) << endl;
+
+    QVector<qint64> samples;
+    int next = options.devices * rowsPerDevice;
+    for (int i = 0; i < options.iterations; i++)
+    {
+        const int device = i % options.devices;
+        const QList<LibraryModel> models = DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(getAddress(device));
+
+        QList<LibraryModel> deleteModels;
+        QList<LibraryModel> updateModels;
+        for (int j = i % 100; j < models.count(); j += 100)
+        {
+            const LibraryModel& model = models.at(j);
+            deleteModels.push_back(model);
+
+            if (j + 50 < models.count())
+            {
+                const LibraryModel& updated = models.at(j + 50);
+                updateModels.push_back(LibraryModel(updated.getId(), updated.getLabel(), updated.getName(), updated.getDeviceName(),
+                                                    updated.getType(), updated.getThumbnailId(), QString("00:00:%1:00").arg(i % 60, 2, 10, QChar('0'))));
+            }
+        }
+
+        const QList<LibraryModel> insertModels = createMedia(next, deleteModels.count());
+        next += deleteModels.count();
+
+        timer.restart();
+        DatabaseManager::getInstance().updateLibraryMedia(getAddress(device), deleteModels, insertModels, updateModels);
+        samples.append(timer.nsecsElapsed());
+    }
+
+    stream << QString("updateLibraryMedia, refresh diff of 3%: %1 (median of %2)").arg(formatTime(getMedian(samples))).arg(options.iterations) << endl;
+
+    // A refresh deletes as many clips as it adds, anything else means a write was lost.
+    const int count = countMedia(options);
+    if (count != rowsPerDevice * options.devices)
+    {
+        stream << QString("The library has %1 rows, expected %2").arg(count).arg(rowsPerDevice * options.devices) << endl;
+        return false;
+    }
+
+    return true;
+}
+
+QList<FilterCase> getFilterCases(const BenchmarkOptions& options)
+{
+    QList<QString> allDevices;
+    for (int device = 0; device < options.devices; device++)
+        allDevices.append(getAddress(device));
+
+    QList<FilterCase> cases;
+    FilterCase common = { "common name, all servers", "CLIP_00", QList<QString>() };
+    FilterCase rare = { "rare name, all servers", "CLIP_0001", QList<QString>() };
+    FilterCase quote = { "name with a quote, all servers", "O'BRIEN", QList<QString>() };
+    FilterCase none = { "no match, all servers", "NOTHING", QList<QString>() };
+    FilterCase server = { "everything on one server", QString(), QList<QString>() << getAddress(0) };
+    FilterCase servers = { "common name, every server listed", "CLIP_00", allDevices };
+    cases << common << rare << quote << none << server << servers;
+
+    return cases;
+}
+
+void benchmarkGetLibraryMediaByFilter(const BenchmarkOptions& options, QTextStream& stream)
+{
+    foreach (const FilterCase& filterCase, getFilterCases(options))
+    {
+        int count = 0;
+        QVector<qint64> samples;
+
+        QElapsedTimer timer;
+        for (int i = 0; i < options.iterations; i++)
+        {
+            timer.start();
+            count = DatabaseManager::getInstance().getLibraryMediaByFilter(filterCase.filter, filterCase.devices).count();
+            samples.append(timer.nsecsElapsed());
+        }
+
+        stream << QString("getLibraryMediaByFilter, %1: %2 for %3 rows").arg(filterCase.description).arg(formatTime(getMedian(samples))).arg(count) << endl;
+    }
+}
+
+// A key in the filter box searches the first page of every media type.
+qint64 timeLibraryIndexSearch(const BenchmarkOptions& options, const QString& filter, const QList<QString>& devices, int& total)
+{
+    QVector<qint64> samples;
+
+    QElapsedTimer timer;
+    for (int i = 0; i < options.iterations; i++)
+    {
+        timer.start();
+
+        total = 0;
+        for (int type = 0; type < 3; type++)
+        {
+            int count = 0;
+            LibraryIndex::getInstance().search(MEDIA_TYPES[type], filter, devices, 0, Library::PAGE_SIZE, count);
+            total += count;
+        }
+
+        samples.append(timer.nsecsElapsed());
+    }
+
+    return getMedian(samples);
+}
+
+void benchmarkLibraryIndexSearch(const BenchmarkOptions& options, QTextStream& stream)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int device = 0; device < options.devices; device++)
+        LibraryIndex::getInstance().update(getAddress(device), QStringList() << "AUDIO" << "MOVIE" << "STILL",
+                                           DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(getAddress(device)));
+
+    stream << QString("LibraryIndex, build: %1").arg(formatTime(timer.nsecsElapsed())) << endl;
+
+    int total = 0;
+    foreach (const FilterCase& filterCase, getFilterCases(options))
+    {
+        const qint64 time = timeLibraryIndexSearch(options, filterCase.filter, filterCase.devices, total);
+        stream << QString("LibraryIndex::search, %1: %2 for %3 matches").arg(filterCase.description).arg(formatTime(time)).arg(total) << endl;
+    }
+
+    // Typing a name searches again on every key, the short filters match the most.
+    const QString name("CLIP_0001");
+
+    qint64 slowest = 0;
+    for (int length = 1; length <= name.length(); length++)
+        slowest = qMax(slowest, timeLibraryIndexSearch(options, name.left(length), QList<QString>(), total));
+
+    stream << QString("LibraryIndex::search, typing %1: %2 for the slowest key").arg(name).arg(formatTime(slowest)) << endl;
+}
+
+// A thumbnail the size a server generates, with enough detail that it does not compress to nothing.
+QByteArray createThumbnail(int seed)
+{
+    QImage image(256, 144, QImage::Format_RGB32);
+    for (int y = 0; y < image.height(); y++)
+    {
+        for (int x = 0; x < image.width(); x++)
+            image.setPixel(x, y, qRgb((x * seed) & 0xFF, (y * 3 + seed) & 0xFF, ((x ^ y) * (seed + 1)) & 0xFF));
+    }
+
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+
+    return data;
+}
+
+int querySize(const QString& query)
+{
+    QSqlQuery sql;
+    sql.exec(query);
+    sql.first();
+
+    return sql.value(0).toInt() / 1024;
+}
+
+// Selecting a clip reads its thumbnail and decodes it for the preview, see PreviewWidget. Before the thumbnail
+// store the PNG was kept as base64 text, which is kept in a table of its own here to compare with.
+void benchmarkThumbnailPreview(QTextStream& stream)
+{
+    const QList<LibraryModel> models = DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(getAddress(0)).mid(0, 1000);
+
+    // Shadow servers and repeated clips share images, ten distinct ones over all clips.
+    QList<QByteArray> images;
+    for (int i = 0; i < 10; i++)
+        images.append(createThumbnail(i + 1));
+
+    for (int i = 0; i < models.count(); i++)
+        DatabaseManager::getInstance().updateThumbnail(ThumbnailModel(0, images.at(i % images.count()), "2000-01-01T00:00:00", "256x144",
+                                                                      models.at(i).getName(), getAddress(0)));
+
+    QSqlQuery sql;
+    sql.exec("CREATE TABLE Base64Thumbnail (Name TEXT PRIMARY KEY, Data TEXT)");
+
+    QSqlDatabase::database().transaction();
+
+    sql.prepare("INSERT INTO Base64Thumbnail (Name, Data) VALUES(?, ?)");
+    for (int i = 0; i < models.count(); i++)
+    {
+        sql.addBindValue(models.at(i).getName());
+        sql.addBindValue(QString(images.at(i % images.count()).toBase64()));
+        sql.exec();
+    }
+
+    QSqlDatabase::database().commit();
+
+    stream << QString("Thumbnails, %1 clips: %2 KB as blobs, %3 KB as base64 text").arg(models.count())
+              .arg(querySize("SELECT SUM(LENGTH(Data)) FROM ThumbnailImage")).arg(querySize("SELECT SUM(LENGTH(Data)) FROM Base64Thumbnail")) << endl;
+
+    QVector<qint64> samples;
+    QVector<qint64> base64Samples;
+
+    sql.prepare("SELECT Data FROM Base64Thumbnail WHERE Name = ?");
+
+    QElapsedTimer timer;
+    foreach (const LibraryModel& model, models)
+    {
+        const QString& name = model.getName();
+
+        timer.start();
+        QImage image;
+        image.loadFromData(DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, "Server 1").getData(), "PNG");
+        samples.append(timer.nsecsElapsed());
+
+        timer.start();
+        sql.addBindValue(name);
+        sql.exec();
+        sql.first();
+        QImage base64Image;
+        base64Image.loadFromData(QByteArray::fromBase64(sql.value(0).toString().toAscii()), "PNG");
+        sql.finish();
+        base64Samples.append(timer.nsecsElapsed());
+    }
+
+    stream << QString("Thumbnails, select a clip: %1 from a blob, %2 from base64 text (median of %3)").arg(formatTime(getMedian(samples)))
+              .arg(formatTime(getMedian(base64Samples))).arg(models.count()) << endl;
+}
+
+// Every rundown item shows the thumbnail of its clip, see RundownVideoWidget. Without the cache each item read,
+// decoded and scaled its thumbnail on the GUI thread when it was created.
+void benchmarkRundownThumbnails(QTextStream& stream)
+{
+    const int items = 1000;
+
+    // Every clip is in the rundown four times.
+    const QList<LibraryModel> models = DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(getAddress(0)).mid(0, items / 4);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int item = 0; item < items; item++)
+    {
+        const QByteArray data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(models.at(item % models.count()).getName(), "Server 1").getData();
+
+        QImage image;
+        if (image.loadFromData(data, "PNG"))
+            QPixmap::fromImage(image.scaled(Rundown::DEFAULT_THUMBNAIL_WIDTH, Rundown::DEFAULT_THUMBNAIL_HEIGHT, Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+    }
+
+    stream << QString("Rundown of %1 items, thumbnails decoded by every item: %2").arg(items).arg(formatTime(timer.nsecsElapsed())) << endl;
+
+    // The second time the rundown is opened everything is cached.
+    for (int open = 0; open < 2; open++)
+    {
+        ThumbnailCounter counter;
+        int pending = 0;
+
+        timer.restart();
+
+        for (int item = 0; item < items; item++)
+        {
+            QPixmap pixmap;
+            QByteArray data;
+            if (!ThumbnailCache::getInstance().getThumbnail(models.at(item % models.count()).getName(), "Server 1", false, pixmap, data,
+                                                            &counter, "setThumbnail"))
+                pending++;
+        }
+
+        const qint64 blocked = timer.nsecsElapsed();
+
+        while (counter.getThumbnails() < pending)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+        stream << QString("Rundown of %1 items, thumbnails from ThumbnailCache%2: %3 on the GUI thread, %4 until all are shown")
+                  .arg(items).arg((open == 0) ? "" : ", opened again").arg(formatTime(blocked)).arg(formatTime(timer.nsecsElapsed())) << endl;
+    }
+}
+
+typedef int (*RundownRead)(const QString& deviceName);
+
+// What a rundown item reads when it is created, see RundownTemplateWidget.
+int openItem(const QString& deviceName)
+{
+    Q_UNUSED(deviceName);
+
+    return DatabaseManager::getInstance().getConfigurationByName("DelayType").getValue().length();
+}
+
+// What a rundown item reads on every take, to compute a delay in frames.
+int takeItem(const QString& deviceName)
+{
+    const QStringList& channelFormats = DatabaseManager::getInstance().getDeviceByName(deviceName).getChannelFormats().split(",");
+
+    return DatabaseManager::getInstance().getFormat(channelFormats[0]).getFramesPerSecond().toInt();
+}
+
+// The same reads with a new SQL query each, the way DatabaseManager read them before the cache.
+QString queryValue(const QString& query, const QString& value)
+{
+    QSqlQuery sql;
+    sql.prepare(query);
+    sql.addBindValue(value);
+    sql.exec();
+    sql.first();
+
+    return sql.value(0).toString();
+}
+
+int openItemBySql(const QString& deviceName)
+{
+    Q_UNUSED(deviceName);
+
+    return queryValue("SELECT c.Value FROM Configuration c WHERE c.Name = ?", "DelayType").length();
+}
+
+int takeItemBySql(const QString& deviceName)
+{
+    const QStringList& channelFormats = queryValue("SELECT d.ChannelFormats FROM Device d WHERE d.Name = ?", deviceName).split(",");
+
+    return queryValue("SELECT f.FramesPerSecond FROM Format f WHERE f.Name = ?", channelFormats[0]).toInt();
+}
+
+qint64 timeRundownReads(const BenchmarkOptions& options, RundownRead read, int items)
+{
+    int result = 0;
+    QVector<qint64> samples;
+
+    QElapsedTimer timer;
+    for (int i = 0; i < options.iterations; i++)
+    {
+        timer.start();
+        for (int item = 0; item < items; item++)
+            result += read(QString("Server %1").arg(item % options.devices + 1));
+
+        samples.append(timer.nsecsElapsed());
+    }
+
+    Q_UNUSED(result);
+
+    return getMedian(samples);
+}
+
+void benchmarkRundownReads(const BenchmarkOptions& options, QTextStream& stream)
+{
+    const int items = 1000;
+
+    stream << QString("Rundown of %1 items, open: %2 cached, %3 by SQL").arg(items)
+              .arg(formatTime(timeRundownReads(options, openItem, items))).arg(formatTime(timeRundownReads(options, openItemBySql, items))) << endl;
+    stream << QString("Rundown of %1 items, take every item: %2 cached, %3 by SQL").arg(items)
+              .arg(formatTime(timeRundownReads(options, takeItem, items))).arg(formatTime(timeRundownReads(options, takeItemBySql, items))) << endl;
+}
+
+int main(int argc, char* argv[])
+{
+#if defined(Q_WS_X11)
+    // Pixmaps need the X server, without one only the database is timed.
+    const bool gui = !qgetenv("DISPLAY").isEmpty();
+#else
+    const bool gui = true;
+#endif
+
+    QApplication application(argc, argv, gui);
+    QTextStream stream(stdout);
+
+    QStringList arguments = application.arguments();
+    arguments.removeFirst();
+
+    BenchmarkOptions options = { 100000, 4, 10 };
+    for (int i = 0; i < arguments.count(); i++)
+    {
+        const QString& argument = arguments.at(i);
+        if (i + 1 >= arguments.count())
+        {
+            printUsage(stream);
+            return 1;
+        }
+
+        if (argument == "-rows")
+            options.rows = arguments.at(++i).toInt();
+        else if (argument == "-devices")
+            options.devices = arguments.at(++i).toInt();
+        else if (argument == "-iterations")
+            options.iterations = arguments.at(++i).toInt();
+        else
+        {
+            printUsage(stream);
+            return 1;
+        }
+    }
+
+    if (options.devices < 1 || options.devices > 254 || options.rows < options.devices || options.iterations < 1)
+    {
+        printUsage(stream);
+        return 1;
+    }
+
+    const QString databaseLocation = QDir::temp().filePath(QString("librarybenchmark-%1.s3db").arg(QCoreApplication::applicationPid()));
+
+    QSqlDatabase database = QSqlDatabase::addDatabase("QSQLITE");
+    database.setDatabaseName(databaseLocation);
+    if (!database.open())
+    {
+        stream << QString("Unable to open %1").arg(databaseLocation) << endl;
+        return 1;
+    }
+
+    DatabaseManager::getInstance().initialize();
+
+    for (int device = 0; device < options.devices; device++)
+        DatabaseManager::getInstance().insertDevice(DeviceModel(0, QString("Server %1").arg(device + 1), getAddress(device), 5250,
+                                                                "", "", "", "", "No", 1, "PAL"));
+
+    const bool succeeded = benchmarkUpdateLibraryMedia(options, stream);
+    benchmarkGetLibraryMediaByFilter(options, stream);
+    benchmarkLibraryIndexSearch(options, stream);
+    benchmarkRundownReads(options, stream);
+    benchmarkThumbnailPreview(stream);
+
+    if (gui)
+        benchmarkRundownThumbnails(stream);
+    else
+        stream << "Rundown thumbnails skipped, no display" << endl;
+
+    DatabaseManager::getInstance().uninitialize();
+    database.close();
+
+    QFile::remove(databaseLocation);
+    QFile::remove(databaseLocation + "-wal");
+    QFile::remove(databaseLocation + "-shm");
+
+    return succeeded ? 0 : 1;
+}
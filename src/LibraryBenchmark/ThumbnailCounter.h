@@ -0,0 +1,25 @@
+#pragma once
+
+#include <QtCore/QObject>
+
+// Stands in for the rundown items, counts the thumbnails ThumbnailCache calls back with.
+class ThumbnailCounter : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit ThumbnailCounter(QObject* parent = 0)
+            : QObject(parent), thumbnails(0)
+        {
+        }
+
+        int getThumbnails() const { return this->thumbnails; }
+
+        Q_SLOT void setThumbnail()
+        {
+            this->thumbnails++;
+        }
+
+    private:
+        int thumbnails;
+};
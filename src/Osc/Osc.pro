@@ -14,12 +14,20 @@ DEFINES += OSC_LIBRARY
 HEADERS += \
     Shared.h \
     OscThread.h \
+    OscArguments.h \
+    OscCapture.h \
+    OscEventQueue.h \
     OscListener.h \
+    OscMessage.h \
     OscSender.h
 	
 SOURCES += \
     OscThread.cpp \
+    OscArguments.cpp \
+    OscCapture.cpp \
+    OscEventQueue.cpp \
     OscListener.cpp \
+    OscMessage.cpp \
     OscSender.cpp
 
 INCLUDEPATH += $$PWD/../../lib/boost
@@ -0,0 +1,166 @@
+#include "OscArguments.h"
+
+OscValue::OscValue()
+    : type(OscValue::Invalid)
+{
+    this->value.int64Value = 0;
+}
+
+OscValue::OscValue(bool value)
+    : type(OscValue::Bool)
+{
+    this->value.boolValue = value;
+}
+
+OscValue::OscValue(qint32 value)
+    : type(OscValue::Int32)
+{
+    this->value.int32Value = value;
+}
+
+OscValue::OscValue(qint64 value)
+    : type(OscValue::Int64)
+{
+    this->value.int64Value = value;
+}
+
+OscValue::OscValue(float value)
+    : type(OscValue::Float)
+{
+    this->value.floatValue = value;
+}
+
+OscValue::OscValue(double value)
+    : type(OscValue::Double)
+{
+    this->value.doubleValue = value;
+}
+
+OscValue::OscValue(const QString& value)
+    : type(OscValue::String), string(value)
+{
+    this->value.int64Value = 0;
+}
+
+OscValue::OscValueType OscValue::getType() const
+{
+    return this->type;
+}
+
+bool OscValue::toBool() const
+{
+    switch (this->type)
+    {
+        case OscValue::String:
+            return !this->string.isEmpty() && this->string != "0" && this->string.toLower() != "false";
+        default:
+            return toLongLong() != 0;
+    }
+}
+
+int OscValue::toInt() const
+{
+    return static_cast<int>(toLongLong());
+}
+
+qint64 OscValue::toLongLong() const
+{
+    switch (this->type)
+    {
+        case OscValue::Bool:
+            return this->value.boolValue ? 1 : 0;
+        case OscValue::Int32:
+            return this->value.int32Value;
+        case OscValue::Int64:
+            return this->value.int64Value;
+        case OscValue::Float:
+            return qRound64(this->value.floatValue);
+        case OscValue::Double:
+            return qRound64(this->value.doubleValue);
+        case OscValue::String:
+            return this->string.toLongLong();
+        default:
+            return 0;
+    }
+}
+
+float OscValue::toFloat() const
+{
+    return static_cast<float>(toDouble());
+}
+
+double OscValue::toDouble() const
+{
+    switch (this->type)
+    {
+        case OscValue::Float:
+            return this->value.floatValue;
+        case OscValue::Double:
+            return this->value.doubleValue;
+        case OscValue::String:
+            return this->string.toDouble();
+        default:
+            return static_cast<double>(toLongLong());
+    }
+}
+
+QString OscValue::toString() const
+{
+    switch (this->type)
+    {
+        case OscValue::Bool:
+            return this->value.boolValue ? "true" : "false";
+        case OscValue::Float:
+        case OscValue::Double:
+            return QString::number(toDouble());
+        case OscValue::String:
+            return this->string;
+        case OscValue::Invalid:
+            return QString();
+        default:
+            return QString::number(toLongLong());
+    }
+}
+
+bool OscValue::operator==(int value) const
+{
+    return this->type != OscValue::Invalid && toLongLong() == value;
+}
+
+bool OscValue::operator!=(int value) const
+{
+    return !(*this == value);
+}
+
+OscArguments::OscArguments()
+    : argumentCount(0)
+{
+}
+
+int OscArguments::count() const
+{
+    return this->argumentCount;
+}
+
+bool OscArguments::isEmpty() const
+{
+    return this->argumentCount == 0;
+}
+
+const OscValue& OscArguments::at(int index) const
+{
+    Q_ASSERT(index >= 0 && index < this->argumentCount);
+
+    return this->values[index];
+}
+
+const OscValue& OscArguments::operator[](int index) const
+{
+    return at(index);
+}
+
+void OscArguments::append(const OscValue& value)
+{
+    if (this->argumentCount < OscArguments::MAX_ARGUMENTS)
+        this->values[this->argumentCount++] = value;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QString>
+
+// One received OSC argument. Numbers are stored inline, strings are shared with the listener's intern
+// table so a value that repeats every frame (like file/path) is not allocated again.
+class OSC_EXPORT OscValue
+{
+    public:
+        enum OscValueType
+        {
+            Invalid,
+            Bool,
+            Int32,
+            Int64,
+            Float,
+            Double,
+            String
+        };
+
+        explicit OscValue();
+        explicit OscValue(bool value);
+        explicit OscValue(qint32 value);
+        explicit OscValue(qint64 value);
+        explicit OscValue(float value);
+        explicit OscValue(double value);
+        explicit OscValue(const QString& value);
+
+        OscValueType getType() const;
+
+        bool toBool() const;
+        int toInt() const;
+        qint64 toLongLong() const;
+        float toFloat() const;
+        double toDouble() const;
+        QString toString() const;
+
+        // Compares the value as an integer, the way remote triggers check for 1.
+        bool operator==(int value) const;
+        bool operator!=(int value) const;
+
+    private:
+        OscValueType type;
+        union
+        {
+            bool boolValue;
+            qint32 int32Value;
+            qint64 int64Value;
+            float floatValue;
+            double doubleValue;
+        } value;
+        QString string;
+};
+
+// The arguments of one message, stored inline and passed by reference from the listener to the subscribers.
+class OSC_EXPORT OscArguments
+{
+    public:
+        static const int MAX_ARGUMENTS = 16;
+
+        explicit OscArguments();
+
+        int count() const;
+        bool isEmpty() const;
+
+        const OscValue& at(int index) const;
+        const OscValue& operator[](int index) const;
+
+        // Arguments beyond MAX_ARGUMENTS are ignored.
+        void append(const OscValue& value);
+
+    private:
+        int argumentCount;
+        OscValue values[MAX_ARGUMENTS];
+};
@@ -0,0 +1,68 @@
+#include "OscCapture.h"
+
+OscCapture::OscCapture()
+{
+}
+
+bool OscCapture::open(const QString& fileName, QIODevice::OpenMode mode)
+{
+    this->file.setFileName(fileName);
+    if (!this->file.open(mode))
+    {
+        this->errorString = this->file.errorString();
+
+        return false;
+    }
+
+    this->stream.setDevice(&this->file);
+
+    if (mode & QIODevice::WriteOnly)
+    {
+        this->stream << OscCapture::MAGIC << OscCapture::VERSION;
+        this->clock.start();
+
+        return true;
+    }
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    this->stream >> magic >> version;
+    if (magic != OscCapture::MAGIC || version != OscCapture::VERSION)
+    {
+        this->file.close();
+        this->errorString = "Not an OSC capture file";
+
+        return false;
+    }
+
+    return true;
+}
+
+void OscCapture::close()
+{
+    this->stream.setDevice(NULL);
+    this->file.close();
+}
+
+const QString OscCapture::getErrorString() const
+{
+    return this->errorString;
+}
+
+void OscCapture::write(const char* data, int size, quint32 address, quint16 port)
+{
+    this->stream << static_cast<qint64>(this->clock.nsecsElapsed() / 1000) << address << port << static_cast<quint32>(size);
+    this->stream.writeRawData(data, size);
+}
+
+bool OscCapture::read(OscCapturePacket& packet)
+{
+    quint32 size = 0;
+    this->stream >> packet.timestamp >> packet.address >> packet.port >> size;
+    if (this->stream.status() != QDataStream::Ok)
+        return false;
+
+    packet.data.resize(size);
+
+    return this->stream.readRawData(packet.data.data(), size) == static_cast<int>(size);
+}
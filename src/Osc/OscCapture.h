@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDataStream>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+// Raw OSC packets with their arrival time, written by OscListener::startCapture() and read by the replay tool.
+// The file starts with MAGIC and VERSION, followed by one record per packet: microseconds since the capture
+// started (qint64), sender IPv4 address (quint32), sender port (quint16), size (quint32) and the packet data.
+class OSC_EXPORT OscCapture
+{
+    public:
+        struct OscCapturePacket
+        {
+            qint64 timestamp;
+            quint32 address;
+            quint16 port;
+            QByteArray data;
+        };
+
+        static const quint32 MAGIC = 0x4f534343; // "OSCC"
+        static const quint32 VERSION = 1;
+
+        explicit OscCapture();
+
+        bool open(const QString& fileName, QIODevice::OpenMode mode);
+        void close();
+
+        const QString getErrorString() const;
+
+        void write(const char* data, int size, quint32 address, quint16 port);
+        bool read(OscCapturePacket& packet);
+
+    private:
+        QFile file;
+        QDataStream stream;
+        QElapsedTimer clock;
+        QString errorString;
+};
@@ -0,0 +1,57 @@
+#include "OscEventQueue.h"
+
+QString OscEvent::getPath() const
+{
+    return QString::fromUtf8(this->data, this->pathLength);
+}
+
+OscEventQueue::OscEventQueue(int capacity)
+    : mask(1), events(NULL), writeIndex(0), readIndex(0)
+{
+    // A power of two so the indexes wrap with a mask, one slot always stays empty to tell full from empty.
+    while (this->mask < capacity)
+        this->mask <<= 1;
+
+    this->events = new OscEvent[this->mask];
+    this->mask--;
+}
+
+OscEventQueue::~OscEventQueue()
+{
+    delete [] this->events;
+}
+
+int OscEventQueue::getCapacity() const
+{
+    return this->mask;
+}
+
+OscEvent* OscEventQueue::beginWrite()
+{
+    // Only the producer stores writeIndex, the acquire pairs with the release in endRead().
+    const int index = this->writeIndex;
+    if (((index + 1) & this->mask) == this->readIndex.fetchAndAddAcquire(0))
+        return NULL;
+
+    return &this->events[index];
+}
+
+void OscEventQueue::endWrite()
+{
+    this->writeIndex.fetchAndStoreRelease((this->writeIndex + 1) & this->mask);
+}
+
+int OscEventQueue::beginRead()
+{
+    return (this->writeIndex.fetchAndAddAcquire(0) - this->readIndex) & this->mask;
+}
+
+const OscEvent& OscEventQueue::at(int index) const
+{
+    return this->events[(this->readIndex + index) & this->mask];
+}
+
+void OscEventQueue::endRead(int count)
+{
+    this->readIndex.fetchAndStoreRelease((this->readIndex + count) & this->mask);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QAtomicInt>
+#include <QtCore/QString>
+
+// One received message, preparsed by the receive thread into a preallocated slot of the queue.
+struct OSC_EXPORT OscEvent
+{
+    enum OscValueType
+    {
+        Bool,
+        Int32,
+        Int64,
+        Float,
+        Double,
+        String
+    };
+
+    static const int MAX_ARGUMENTS = 16;
+    static const int MAX_DATA = 512;
+
+    int pathId; // Interned by the receive thread, equal paths always get the same id.
+    quint32 replyAddress;
+    int replyPort;
+    bool limited; // A control message over the rate limit of its sender, answered but not dispatched.
+    int pathLength;
+    int argumentCount;
+    int dataLength;
+    char types[MAX_ARGUMENTS];
+    union
+    {
+        bool boolValue;
+        qint32 int32Value;
+        qint64 int64Value;
+        float floatValue;
+        double doubleValue;
+        int stringOffset;
+    } values[MAX_ARGUMENTS];
+    char data[MAX_DATA]; // The path followed by the string arguments, each NUL terminated.
+
+    QString getPath() const;
+};
+
+// Lock-free ring with a single producer (the receive thread) and a single consumer (the GUI thread).
+// Neither side blocks or allocates, the producer gets NULL from beginWrite() when the ring is full.
+class OSC_EXPORT OscEventQueue
+{
+    public:
+        explicit OscEventQueue(int capacity);
+        ~OscEventQueue();
+
+        int getCapacity() const;
+
+        OscEvent* beginWrite();
+        void endWrite();
+
+        // Events stay valid until endRead(), index 0 is the oldest.
+        int beginRead();
+        const OscEvent& at(int index) const;
+        void endRead(int count);
+
+    private:
+        Q_DISABLE_COPY(OscEventQueue)
+
+        int mask;
+        OscEvent* events;
+        QAtomicInt writeIndex;
+        QAtomicInt readIndex;
+};
@@ -1,92 +1,465 @@
 #include "OscListener.h"
 
+#include <string.h>
+
+#include <stdexcept>
+
 #include <QtCore/QString>
-#include <QtCore/QThread>
-#include <QtCore/QTimer>
-#include <QtCore/QPair>
 #include <QtCore/QDebug>
 
-OscListener::OscListener(const QString& address, int port, QObject* parent)
-    : QObject(parent)
+OscListener::OscSource::OscSource(quint32 address)
+    : address(address), queue(OscListener::SOURCE_QUEUE_CAPACITY), dropped(0), controls(0), limited(0), controlTokens(-1), controlRefilled(0),
+      received(0), coalesced(0), batches(0), lastBatch(0)
+{
+}
+
+OscListener::OscListener(int batchInterval, QObject* parent)
+    : QObject(parent),
+      sourceCount(0), controlQueue(OscListener::CONTROL_QUEUE_CAPACITY), controlScheduled(0), controlRateLimit(0), capturing(0)
 {
-    this->socket = new UdpSocket();
-    this->socket->SetAllowReuse(true);
-    this->socket->Bind(IpEndpointName(address.toStdString().c_str(), port));
+    this->clock.start();
 
     this->multiplexer = new SocketReceiveMultiplexer();
-    this->multiplexer->AttachSocketListener(this->socket, this);
 
     this->thread = new OscThread(this->multiplexer, this);
 
-    QTimer::singleShot(200, this, SLOT(sendEventBatch()));
+    this->batch.reserve(OscListener::SOURCE_QUEUE_CAPACITY);
+
+    this->batchTimer.setInterval(batchInterval);
+    QObject::connect(&this->batchTimer, SIGNAL(timeout()), this, SLOT(sendEventBatch()));
 }
 
 OscListener::~OscListener()
 {
+    stopCapture();
+
     this->thread->stop();
     //this->thread->wait();
 
-    delete this->socket;
+    foreach (UdpSocket* socket, this->sockets)
+    {
+        this->multiplexer->DetachSocketListener(socket, this);
+        delete socket;
+    }
+
     delete this->multiplexer;
     delete this->thread;
+
+    for (int i = 0; i < this->sourceCount; i++)
+        delete this->sources[i];
+}
+
+bool OscListener::addEndpoint(const QString& address, int port)
+{
+    UdpSocket* socket = new UdpSocket();
+    try
+    {
+        socket->SetAllowReuse(true);
+        socket->Bind(IpEndpointName(address.toStdString().c_str(), port));
+    }
+    catch (const std::exception& exception)
+    {
+        qWarning() << QString("Failed to listen for OSC on %1:%2, Error: %3").arg(address).arg(port).arg(exception.what());
+
+        delete socket;
+
+        return false;
+    }
+
+    this->multiplexer->AttachSocketListener(socket, this);
+    this->sockets.append(socket);
+
+    return true;
 }
 
 void OscListener::start()
 {
     this->thread->start();
+    this->batchTimer.start();
+}
+
+void OscListener::setBatchInterval(int batchInterval)
+{
+    this->batchTimer.setInterval(batchInterval);
+}
+
+void OscListener::setControlRateLimit(int rateLimit)
+{
+    this->controlRateLimit.fetchAndStoreRelease(qMax(0, rateLimit));
+}
+
+const OscListener::OscListenerStatistics OscListener::getStatistics() const
+{
+    OscListenerStatistics statistics = { QString(), 0, 0, 0, 0, 0, 0, 0, this->batchTimer.interval() };
+    foreach (const OscListenerStatistics& source, getSourceStatistics())
+    {
+        statistics.received += source.received;
+        statistics.coalesced += source.coalesced;
+        statistics.dropped += source.dropped;
+        statistics.controls += source.controls;
+        statistics.limited += source.limited;
+        statistics.batches = qMax(statistics.batches, source.batches);
+        statistics.lastBatch += source.lastBatch;
+    }
+
+    return statistics;
+}
+
+const QList<OscListener::OscListenerStatistics> OscListener::getSourceStatistics() const
+{
+    QList<OscListenerStatistics> statistics;
+
+    const int count = this->sourceCount.fetchAndAddAcquire(0);
+    for (int i = 0; i < count; i++)
+        statistics.append(getSourceStatistics(this->sources[i]));
+
+    return statistics;
+}
+
+void OscListener::readArguments(const OscEvent& event, OscArguments& arguments)
+{
+    for (int i = 0; i < event.argumentCount; i++)
+    {
+        switch (event.types[i])
+        {
+            case OscEvent::Bool:
+                arguments.append(OscValue(event.values[i].boolValue));
+                break;
+            case OscEvent::Int32:
+                arguments.append(OscValue(event.values[i].int32Value));
+                break;
+            case OscEvent::Int64:
+                arguments.append(OscValue(event.values[i].int64Value));
+                break;
+            case OscEvent::Float:
+                arguments.append(OscValue(event.values[i].floatValue));
+                break;
+            case OscEvent::Double:
+                arguments.append(OscValue(event.values[i].doubleValue));
+                break;
+            case OscEvent::String:
+            {
+                const char* data = event.data + event.values[i].stringOffset;
+                const QByteArray key = QByteArray::fromRawData(data, qstrlen(data));
+
+                QHash<QByteArray, QString>::const_iterator position = this->strings.constFind(key);
+                if (position == this->strings.constEnd())
+                {
+                    if (this->strings.count() >= OscListener::MAX_STRINGS)
+                        this->strings.clear();
+
+                    position = this->strings.insert(QByteArray(data), QString::fromUtf8(data));
+                }
+
+                arguments.append(OscValue(position.value()));
+                break;
+            }
+        }
+    }
+}
+
+const OscListener::OscListenerStatistics OscListener::getSourceStatistics(const OscSource* source) const
+{
+    const QString address = (source->address == 0) ? QString("Other") : formatAddress(source->address);
+
+    OscListenerStatistics statistics = { address, source->received, source->coalesced, static_cast<int>(source->dropped),
+                                         static_cast<int>(source->controls), static_cast<int>(source->limited),
+                                         source->batches, source->lastBatch, this->batchTimer.interval() };
+
+    return statistics;
+}
+
+QString OscListener::formatAddress(quint32 address)
+{
+    return QString("%1.%2.%3.%4").arg((address >> 24) & 0xff).arg((address >> 16) & 0xff).arg((address >> 8) & 0xff).arg(address & 0xff);
+}
+
+bool OscListener::startCapture(const QString& fileName)
+{
+    QMutexLocker locker(&this->captureMutex);
+
+    this->capturing.fetchAndStoreOrdered(0);
+    this->capture.close();
+
+    if (!this->capture.open(fileName, QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << QString("Failed to open OSC capture %1, Error: %2").arg(fileName).arg(this->capture.getErrorString());
+
+        return false;
+    }
+
+    this->capturing.fetchAndStoreOrdered(1);
+
+    qDebug() << QString("Capturing OSC to %1").arg(fileName);
+
+    return true;
+}
+
+void OscListener::stopCapture()
+{
+    QMutexLocker locker(&this->captureMutex);
+
+    this->capturing.fetchAndStoreOrdered(0);
+    this->capture.close();
+}
+
+void OscListener::ProcessPacket(const char* data, int size, const IpEndpointName& endpoint)
+{
+    // The mutex is only taken while capturing.
+    if (this->capturing)
+    {
+        QMutexLocker locker(&this->captureMutex);
+        if (this->capturing)
+            this->capture.write(data, size, static_cast<quint32>(endpoint.address), static_cast<quint16>(endpoint.port));
+    }
+
+    osc::OscPacketListener::ProcessPacket(data, size, endpoint);
+}
+
+OscListener::OscSource* OscListener::findSource(quint32 address)
+{
+    QHash<quint32, OscSource*>::const_iterator source = this->sourceIndex.constFind(address);
+    if (source != this->sourceIndex.constEnd())
+        return source.value();
+
+    OscSource* entry = NULL;
+
+    const int count = this->sourceCount;
+    if (count < OscListener::MAX_SOURCES)
+    {
+        // The last source is shared by every sender that does not get one of its own.
+        entry = new OscSource((count < OscListener::MAX_SOURCES - 1) ? address : 0);
+
+        this->sources[count] = entry;
+        this->sourceCount.fetchAndStoreRelease(count + 1);
+    }
+    else
+        entry = this->sources[OscListener::MAX_SOURCES - 1];
+
+    this->sourceIndex.insert(address, entry);
+
+    return entry;
 }
 
 void OscListener::ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint)
 {
-    char addressBuffer[256];
+    OscSource* source = findSource(static_cast<quint32>(endpoint.address));
+
+    if (::strncmp(message.AddressPattern(), "/control", 8) == 0)
+    {
+        OscEvent* event = this->controlQueue.beginWrite();
+        if (event == NULL || !parseMessage(message, endpoint, *event))
+        {
+            source->dropped.ref();
+            return;
+        }
+
+        event->replyAddress = static_cast<quint32>(endpoint.address);
+        event->replyPort = endpoint.port;
+        event->limited = !acquireControlToken(source);
+
+        source->controls.ref();
+        if (event->limited)
+            source->limited.ref();
+
+        this->controlQueue.endWrite();
+
+        if (this->controlScheduled.testAndSetOrdered(0, 1))
+            QMetaObject::invokeMethod(this, "sendControlEvents", Qt::QueuedConnection);
+
+        return;
+    }
+
+    OscEvent* event = source->queue.beginWrite();
+    if (event == NULL || !parseMessage(message, endpoint, *event))
+    {
+        source->dropped.ref();
+        return;
+    }
+
+    //qDebug() << "OSC message received: " << event->getPath();
+
+    source->queue.endWrite();
+}
+
+bool OscListener::acquireControlToken(OscSource* source)
+{
+    const int rateLimit = this->controlRateLimit;
+    if (rateLimit <= 0)
+        return true;
+
+    // A token bucket holding at most one second worth of messages, a new sender starts with it full.
+    const qint64 capacity = static_cast<qint64>(rateLimit) * 1000;
+    const qint64 now = this->clock.elapsed();
+    if (source->controlTokens < 0)
+        source->controlTokens = capacity;
+    else
+        source->controlTokens = qMin(capacity, source->controlTokens + (now - source->controlRefilled) * rateLimit);
+
+    source->controlRefilled = now;
+
+    if (source->controlTokens < 1000)
+        return false;
 
-    endpoint.AddressAsString(addressBuffer);
+    source->controlTokens -= 1000;
+
+    return true;
+}
+
+bool OscListener::parseMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint, OscEvent& event)
+{
+    if (message.ArgumentCount() > static_cast<osc::uint32>(OscEvent::MAX_ARGUMENTS))
+        return false;
+
+    // The path is the sender address followed by the address pattern.
+    endpoint.AddressAsString(event.data);
+
+    const int addressLength = ::strlen(event.data);
+    const char* addressPattern = message.AddressPattern();
+    const int addressPatternLength = ::strlen(addressPattern);
+    if (addressLength + addressPatternLength + 1 > OscEvent::MAX_DATA)
+        return false;
+
+    ::memcpy(event.data + addressLength, addressPattern, addressPatternLength + 1);
+
+    event.pathLength = addressLength + addressPatternLength;
+    event.dataLength = event.pathLength + 1;
+    event.argumentCount = 0;
 
-    QList<QVariant> arguments;
     for (osc::ReceivedMessage::const_iterator iterator = message.ArgumentsBegin(); iterator != message.ArgumentsEnd(); ++iterator)
     {
         const osc::ReceivedMessageArgument& argument = *iterator;
+        const int index = event.argumentCount;
 
         if (argument.IsBool())
-            arguments.push_back(argument.AsBool());
+        {
+            event.types[index] = OscEvent::Bool;
+            event.values[index].boolValue = argument.AsBool();
+        }
         else if (argument.IsInt32())
-            arguments.push_back(QVariant::fromValue<qint32>(argument.AsInt32()));
+        {
+            event.types[index] = OscEvent::Int32;
+            event.values[index].int32Value = argument.AsInt32();
+        }
         else if (argument.IsInt64())
-            arguments.push_back(QVariant::fromValue<qint64>(argument.AsInt64()));
+        {
+            event.types[index] = OscEvent::Int64;
+            event.values[index].int64Value = argument.AsInt64();
+        }
         else if (argument.IsFloat())
-            arguments.push_back(argument.AsFloat());
+        {
+            event.types[index] = OscEvent::Float;
+            event.values[index].floatValue = argument.AsFloat();
+        }
         else if (argument.IsDouble())
-            arguments.push_back(argument.AsDouble());
+        {
+            event.types[index] = OscEvent::Double;
+            event.values[index].doubleValue = argument.AsDouble();
+        }
         else if (argument.IsString())
-            arguments.push_back(argument.AsString());
-    }
+        {
+            const char* value = argument.AsString();
+            const int length = ::strlen(value);
+            if (event.dataLength + length + 1 > OscEvent::MAX_DATA)
+                return false;
 
-    QString eventMessage = QString("%1").arg(message.AddressPattern());
-    QString eventPath = QString("%1%2").arg(addressBuffer).arg(message.AddressPattern());
+            ::memcpy(event.data + event.dataLength, value, length + 1);
 
-    //qDebug() << "OSC message received: " << eventPath;
+            event.types[index] = OscEvent::String;
+            event.values[index].stringOffset = event.dataLength;
+            event.dataLength += length + 1;
+        }
+        else
+            continue;
 
-    QMutexLocker locker(&eventsMutex);
-    if (eventMessage.startsWith("/control"))
-    {
-        // Do not overwrite control commands already in queue.
-        if (!this->events.contains(eventPath))
-            this->events[eventPath] = arguments;
+        event.argumentCount++;
     }
-    else
-        this->events[eventPath] = arguments;
+
+    // Only allocates the first time a path is seen.
+    QHash<QByteArray, int>::const_iterator pathId = this->pathIds.constFind(QByteArray::fromRawData(event.data, event.pathLength));
+    if (pathId == this->pathIds.constEnd())
+        pathId = this->pathIds.insert(QByteArray(event.data, event.pathLength), this->pathIds.count());
+
+    event.pathId = pathId.value();
+
+    return true;
 }
 
 void OscListener::sendEventBatch()
 {
-    QMap<QString, QList<QVariant> > other;
+    const int count = this->sourceCount.fetchAndAddAcquire(0);
+    for (int i = 0; i < count; i++)
+        sendSourceBatch(this->sources[i]);
+}
+
+void OscListener::sendSourceBatch(OscSource* source)
+{
+    const int count = source->queue.beginRead();
+    if (count == 0)
+        return;
+
+    this->batch.resize(0);
+    for (int i = 0; i < count; i++)
     {
-        QMutexLocker locker(&eventsMutex);
-        this->events.swap(other);
+        const OscEvent& event = source->queue.at(i);
+        while (this->paths.count() <= event.pathId)
+        {
+            this->paths.append(QString());
+            this->batchIndex.append(-1);
+        }
+
+        if (this->paths.at(event.pathId).isNull())
+            this->paths[event.pathId] = event.getPath();
+
+        int& position = this->batchIndex[event.pathId];
+        if (position < 0)
+        {
+            position = this->batch.count();
+            this->batch.append(i);
+        }
+        else
+        {
+            this->batch[position] = i;
+            source->coalesced++;
+        }
     }
 
-    foreach (const QString& eventPath, other.keys())
-        emit messageReceived(eventPath, other[eventPath]);
+    foreach (int index, this->batch)
+        this->batchIndex[source->queue.at(index).pathId] = -1;
+
+    // The events are not released until the whole batch has been sent, so no copies are needed.
+    foreach (int index, this->batch)
+    {
+        const OscEvent& event = source->queue.at(index);
+
+        OscArguments arguments;
+        readArguments(event, arguments);
+
+        emit messageReceived(this->paths.at(event.pathId), arguments);
+    }
+
+    source->queue.endRead(count);
+
+    source->received += count;
+    source->batches++;
+    source->lastBatch = this->batch.count();
+}
+
+void OscListener::sendControlEvents()
+{
+    // Cleared before the queue is read, anything written after this schedules another call.
+    this->controlScheduled.fetchAndStoreOrdered(0);
+
+    const int count = this->controlQueue.beginRead();
+    for (int i = 0; i < count; i++)
+    {
+        const OscEvent& event = this->controlQueue.at(i);
+
+        OscArguments arguments;
+        readArguments(event, arguments);
+
+        emit controlReceived(event.getPath(), arguments, formatAddress(event.replyAddress), event.replyPort, !event.limited);
+    }
 
-    QTimer::singleShot(200, this, SLOT(sendEventBatch()));
+    this->controlQueue.endRead(count);
 }
@@ -1,38 +1,143 @@
 #pragma once
 
 #include "Shared.h"
+#include "OscArguments.h"
+#include "OscCapture.h"
+#include "OscEventQueue.h"
 #include "OscThread.h"
 
 #include <osc/OscReceivedElements.h>
 #include <osc/OscPacketListener.h>
 #include <ip/UdpSocket.h>
 
-#include <QtCore/QObject>
-#include <QtCore/QMap>
-#include <QtCore/QVariant>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
 
 class OSC_EXPORT OscListener : public QObject, public osc::OscPacketListener
 {
     Q_OBJECT
 
     public:
-        explicit OscListener(const QString& address, int port, QObject* parent = 0);
+        struct OscListenerStatistics
+        {
+            QString address; // The sender, empty for the totals.
+            qint64 received;
+            qint64 coalesced; // Replaced by a newer value for the same path before the batch was sent.
+            qint64 dropped; // The queue was full or the message did not fit in a slot.
+            qint64 controls;
+            qint64 limited; // Control messages refused by the rate limit.
+            int batches;
+            int lastBatch;
+            int batchInterval;
+        };
+
+        explicit OscListener(int batchInterval, QObject* parent = 0);
         ~OscListener();
 
+        // All endpoints share one receive thread, add them before start().
+        bool addEndpoint(const QString& address, int port);
+
         void start();
 
-        Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&);
+        // Received messages are delivered in batches, only the latest value of every path is sent.
+        // Shorter intervals lower the latency (e.g. 40 ms for a smooth timecode) at the cost of CPU.
+        void setBatchInterval(int batchInterval);
+
+        // Messages below /control are not batched, they are delivered one by one in arrival order through
+        // controlReceived() as soon as the GUI thread gets to them. Each sender may send at most rateLimit
+        // of them per second (0 turns the limit off), the rest are reported with accepted set to false.
+        void setControlRateLimit(int rateLimit);
+
+        const OscListenerStatistics getStatistics() const;
+        const QList<OscListenerStatistics> getSourceStatistics() const;
+
+        // Writes every received packet, before it is parsed, to an OscCapture file.
+        bool startCapture(const QString& fileName);
+        void stopCapture();
+
+        Q_SIGNAL void messageReceived(const QString&, const OscArguments&);
+        Q_SIGNAL void controlReceived(const QString&, const OscArguments&, const QString& replyAddress, int replyPort, bool accepted);
 
     protected:
+        virtual void ProcessPacket(const char* data, int size, const IpEndpointName& endpoint);
         virtual void ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint);
 
     private:
-        QMutex eventsMutex;
-        QMap<QString, QList<QVariant> > events;
+        // Every sender gets its own queue, so a busy server only fills its own queue and
+        // is coalesced and counted on its own. Senders beyond MAX_SOURCES share the last one.
+        struct OscSource
+        {
+            explicit OscSource(quint32 address);
+
+            quint32 address;
+            OscEventQueue queue;
+            QAtomicInt dropped;
+            QAtomicInt controls;
+            QAtomicInt limited;
+
+            // Owned by the receive thread, the control rate limit in thousandths of a message.
+            qint64 controlTokens;
+            qint64 controlRefilled;
+
+            // Owned by the GUI thread.
+            qint64 received;
+            qint64 coalesced;
+            int batches;
+            int lastBatch;
+        };
+
+        static const int SOURCE_QUEUE_CAPACITY = 1024;
+        static const int MAX_SOURCES = 32;
+        static const int MAX_STRINGS = 1024;
+        static const int CONTROL_QUEUE_CAPACITY = 256;
+
         OscThread* thread;
-        UdpSocket* socket;
+        QList<UdpSocket*> sockets;
         SocketReceiveMultiplexer* multiplexer;
 
+        // Written by the receive thread only, sourceCount is published after the source is in place.
+        OscSource* sources[MAX_SOURCES];
+        QAtomicInt sourceCount;
+
+        // Control messages from every sender in arrival order. controlScheduled is set while a call
+        // to sendControlEvents() is pending, so a burst wakes the GUI thread only once.
+        OscEventQueue controlQueue;
+        QAtomicInt controlScheduled;
+        QAtomicInt controlRateLimit;
+        QElapsedTimer clock;
+
+        QAtomicInt capturing;
+        QMutex captureMutex;
+        OscCapture capture;
+
+        // Owned by the receive thread.
+        QHash<QByteArray, int> pathIds;
+        QHash<quint32, OscSource*> sourceIndex;
+
+        // Owned by the GUI thread, indexed by path id.
+        QVector<QString> paths;
+        QVector<int> batchIndex;
+        QVector<int> batch;
+        QTimer batchTimer;
+
+        // String arguments seen before, most of them (file names, templates) repeat in every message.
+        QHash<QByteArray, QString> strings;
+
+        OscSource* findSource(quint32 address);
+        bool acquireControlToken(OscSource* source);
+        void sendSourceBatch(OscSource* source);
+        const OscListenerStatistics getSourceStatistics(const OscSource* source) const;
+        static QString formatAddress(quint32 address);
+        void readArguments(const OscEvent& event, OscArguments& arguments);
+        bool parseMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint, OscEvent& event);
+
         Q_SLOT void sendEventBatch();
+        Q_SLOT void sendControlEvents();
 };
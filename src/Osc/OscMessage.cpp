@@ -0,0 +1,117 @@
+#include "OscMessage.h"
+
+namespace
+{
+    // OSC strings are NUL terminated and padded to a multiple of four bytes.
+    int paddedSize(int length)
+    {
+        return (length + 4) & ~3;
+    }
+}
+
+OscMessage::OscMessage(const QString& path)
+    : path(path.toUtf8())
+{
+    this->size = paddedSize(this->path.length()) + paddedSize(1);
+}
+
+OscMessage& OscMessage::addArgument(char type, int size)
+{
+    OscArgument argument;
+    argument.type = type;
+
+    this->arguments.append(argument);
+
+    // One more type tag, the type tag string starts with a comma.
+    this->size += paddedSize(this->arguments.count() + 1) - paddedSize(this->arguments.count()) + size;
+
+    return *this;
+}
+
+OscMessage& OscMessage::addBool(bool value)
+{
+    addArgument(value ? osc::TRUE_TYPE_TAG : osc::FALSE_TYPE_TAG, 0);
+    this->arguments.last().value.boolValue = value;
+
+    return *this;
+}
+
+OscMessage& OscMessage::addInt32(qint32 value)
+{
+    addArgument(osc::INT32_TYPE_TAG, 4);
+    this->arguments.last().value.int32Value = value;
+
+    return *this;
+}
+
+OscMessage& OscMessage::addInt64(qint64 value)
+{
+    addArgument(osc::INT64_TYPE_TAG, 8);
+    this->arguments.last().value.int64Value = value;
+
+    return *this;
+}
+
+OscMessage& OscMessage::addFloat(float value)
+{
+    addArgument(osc::FLOAT_TYPE_TAG, 4);
+    this->arguments.last().value.floatValue = value;
+
+    return *this;
+}
+
+OscMessage& OscMessage::addDouble(double value)
+{
+    addArgument(osc::DOUBLE_TYPE_TAG, 8);
+    this->arguments.last().value.doubleValue = value;
+
+    return *this;
+}
+
+OscMessage& OscMessage::addString(const QString& value)
+{
+    QByteArray string = value.toUtf8();
+
+    addArgument(osc::STRING_TYPE_TAG, paddedSize(string.length()));
+    this->arguments.last().string = string;
+
+    return *this;
+}
+
+int OscMessage::getSize() const
+{
+    return this->size;
+}
+
+void OscMessage::write(osc::OutboundPacketStream& stream) const
+{
+    stream << osc::BeginMessage(this->path.constData());
+
+    foreach (const OscArgument& argument, this->arguments)
+    {
+        switch (argument.type)
+        {
+            case osc::TRUE_TYPE_TAG:
+            case osc::FALSE_TYPE_TAG:
+                stream << argument.value.boolValue;
+                break;
+            case osc::INT32_TYPE_TAG:
+                stream << static_cast<osc::int32>(argument.value.int32Value);
+                break;
+            case osc::INT64_TYPE_TAG:
+                stream << static_cast<osc::int64>(argument.value.int64Value);
+                break;
+            case osc::FLOAT_TYPE_TAG:
+                stream << argument.value.floatValue;
+                break;
+            case osc::DOUBLE_TYPE_TAG:
+                stream << argument.value.doubleValue;
+                break;
+            case osc::STRING_TYPE_TAG:
+                stream << argument.string.constData();
+                break;
+        }
+    }
+
+    stream << osc::EndMessage;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <osc/OscOutboundPacketStream.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+// A typed OSC message with any number of arguments: OscMessage("/path").addInt32(1).addString("text").
+// The path and strings are converted once when the message is built, not when it is sent.
+class OSC_EXPORT OscMessage
+{
+    public:
+        explicit OscMessage(const QString& path);
+
+        OscMessage& addBool(bool value);
+        OscMessage& addInt32(qint32 value);
+        OscMessage& addInt64(qint64 value);
+        OscMessage& addFloat(float value);
+        OscMessage& addDouble(double value);
+        OscMessage& addString(const QString& value);
+
+        // Encoded size in bytes, not counting the size prefix it gets inside a bundle.
+        int getSize() const;
+
+        void write(osc::OutboundPacketStream& stream) const;
+
+    private:
+        struct OscArgument
+        {
+            char type;
+            union
+            {
+                bool boolValue;
+                qint32 int32Value;
+                qint64 int64Value;
+                float floatValue;
+                double doubleValue;
+            } value;
+            QByteArray string;
+        };
+
+        QByteArray path;
+        QVector<OscArgument> arguments;
+        int size;
+
+        OscMessage& addArgument(char type, int size);
+};
@@ -1,37 +1,102 @@
 #include "OscSender.h"
 
+#include <stdexcept>
+
+#include <QtCore/QDebug>
 #include <QtCore/QString>
-#include <QtCore/QVariant>
 
 OscSender::OscSender(QObject* parent)
-    : QObject(parent)
+    : QObject(parent),
+      flushScheduled(false)
 {
+    this->buffer.resize(OscSender::MAX_BUNDLE_SIZE + OscSender::BUFFER_SLACK);
 }
 
 OscSender::~OscSender()
 {
+    foreach (const OscDestination& destination, this->destinations)
+        delete destination.socket;
+}
+
+void OscSender::send(const QString& address, int port, const OscMessage& message)
+{
+    QHash<QPair<QString, int>, OscDestination>::iterator destination = this->destinations.find(qMakePair(address, port));
+    if (destination == this->destinations.end())
+    {
+        OscDestination entry;
+        try
+        {
+            entry.socket = new UdpTransmitSocket(IpEndpointName(address.toStdString().c_str(), port));
+        }
+        catch (const std::exception& exception)
+        {
+            qWarning() << QString("Failed to open OSC output %1:%2, Error: %3").arg(address).arg(port).arg(exception.what());
+            return;
+        }
+
+        destination = this->destinations.insert(qMakePair(address, port), entry);
+    }
+
+    destination.value().messages.append(message);
+
+    if (!this->flushScheduled)
+    {
+        this->flushScheduled = true;
+        QMetaObject::invokeMethod(this, "flushMessages", Qt::QueuedConnection);
+    }
 }
 
-void OscSender::send(const QString& address, int port, const QString& path, const QVariant& message)
+void OscSender::flushMessages()
 {
-    UdpTransmitSocket transmitSocket(IpEndpointName(address.toStdString().c_str(), port));
-
-    char buffer[256];
-    osc::OutboundPacketStream stream(buffer, 256);
-
-    bool isInt = false;
-    int val = message.toInt(&isInt);
-
-    if (message.type() == QMetaType::Bool)
-        stream << osc::BeginBundleImmediate << osc::BeginMessage(path.toStdString().c_str()) << message.toBool() << osc::EndMessage << osc::EndBundle;
-    else if (message.type() == QMetaType::Double)
-        stream << osc::BeginBundleImmediate << osc::BeginMessage(path.toStdString().c_str()) << message.toDouble() << osc::EndMessage << osc::EndBundle;
-    else if (message.type() == QMetaType::Float)
-        stream << osc::BeginBundleImmediate << osc::BeginMessage(path.toStdString().c_str()) << message.toFloat() << osc::EndMessage << osc::EndBundle;
-    else if (message.type() == QMetaType::Int)
-        stream << osc::BeginBundleImmediate << osc::BeginMessage(path.toStdString().c_str()) << message.toInt() << osc::EndMessage << osc::EndBundle;   
-    else if (message.type() == QMetaType::QString)
-        stream << osc::BeginBundleImmediate << osc::BeginMessage(path.toStdString().c_str()) << message.toString().toUtf8().constData() << osc::EndMessage << osc::EndBundle;
-
-    transmitSocket.Send(stream.Data(), stream.Size());
+    this->flushScheduled = false;
+
+    for (QHash<QPair<QString, int>, OscDestination>::iterator destination = this->destinations.begin(); destination != this->destinations.end(); ++destination)
+    {
+        QList<OscMessage>& messages = destination.value().messages;
+        if (messages.isEmpty())
+            continue;
+
+        int begin = 0;
+        int size = OscSender::BUNDLE_HEADER_SIZE;
+        for (int i = 0; i < messages.count(); i++)
+        {
+            const int messageSize = messages.at(i).getSize() + 4;
+            if (i > begin && size + messageSize > OscSender::MAX_BUNDLE_SIZE)
+            {
+                sendBundle(destination.value().socket, messages, begin, i, size);
+
+                begin = i;
+                size = OscSender::BUNDLE_HEADER_SIZE;
+            }
+
+            size += messageSize;
+        }
+
+        sendBundle(destination.value().socket, messages, begin, messages.count(), size);
+
+        messages.clear();
+    }
+}
+
+void OscSender::sendBundle(UdpTransmitSocket* socket, const QList<OscMessage>& messages, int begin, int end, int size)
+{
+    // Only a single message larger than a datagram makes the buffer grow.
+    if (this->buffer.size() < size + OscSender::BUFFER_SLACK)
+        this->buffer.resize(size + OscSender::BUFFER_SLACK);
+
+    try
+    {
+        osc::OutboundPacketStream stream(this->buffer.data(), this->buffer.size());
+
+        stream << osc::BeginBundleImmediate;
+        for (int i = begin; i < end; i++)
+            messages.at(i).write(stream);
+        stream << osc::EndBundle;
+
+        socket->Send(stream.Data(), stream.Size());
+    }
+    catch (const std::exception& exception)
+    {
+        qWarning() << QString("Failed to send OSC bundle, Error: %1").arg(exception.what());
+    }
 }
@@ -1,14 +1,17 @@
 #pragma once
 
 #include "Shared.h"
+#include "OscMessage.h"
 
 #include "osc/OscOutboundPacketStream.h"
 #include <ip/UdpSocket.h>
 
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QObject>
-#include <QtCore/QMap>
-#include <QtCore/QVariant>
-#include <QtCore/QMutex>
+#include <QtCore/QPair>
+#include <QtCore/QString>
 
 class OSC_EXPORT OscSender : public QObject
 {
@@ -18,5 +21,29 @@ class OSC_EXPORT OscSender : public QObject
         explicit OscSender(QObject* parent = 0);
         ~OscSender();
 
-        void send(const QString& address, int port, const QString& path, const QVariant& message);
+        // Messages sent during the current event loop iteration go out as one bundle per destination
+        // (or a few, bundles are kept within a single datagram) when control returns to the event loop.
+        void send(const QString& address, int port, const OscMessage& message);
+
+    private:
+        // Bundles larger than this are split, so they fit a single Ethernet frame and the receive buffer
+        // of common OSC implementations.
+        static const int MAX_BUNDLE_SIZE = 1472;
+        static const int BUNDLE_HEADER_SIZE = 16;
+        static const int BUFFER_SLACK = 64;
+
+        struct OscDestination
+        {
+            UdpTransmitSocket* socket;
+            QList<OscMessage> messages;
+        };
+
+        // Sockets are created, and the host resolved, the first time a destination is used.
+        QHash<QPair<QString, int>, OscDestination> destinations;
+        QByteArray buffer;
+        bool flushScheduled;
+
+        void sendBundle(UdpTransmitSocket* socket, const QList<OscMessage>& messages, int begin, int end, int size);
+
+        Q_SLOT void flushMessages();
 };
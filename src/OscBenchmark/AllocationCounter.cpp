@@ -0,0 +1,88 @@
+#include "AllocationCounter.h"
+
+#include <stdlib.h> // Defines __GLIBC__.
+
+#if defined(__GLIBC__)
+
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+
+namespace
+{
+    volatile qint64 allocations = 0;
+    volatile qint64 bytes = 0;
+    __thread bool excluded = false;
+
+    inline void count(size_t size)
+    {
+        if (excluded)
+            return;
+
+        __sync_fetch_and_add(&allocations, 1);
+        __sync_fetch_and_add(&bytes, static_cast<qint64>(size));
+    }
+}
+
+// Qt allocates through qMalloc() and operator new, both end up here. A realloc() counts as an allocation,
+// it is what a growing QByteArray, QString or QVector costs.
+extern "C" void* malloc(size_t size)
+{
+    count(size);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t elements, size_t size)
+{
+    count(elements * size);
+    return __libc_calloc(elements, size);
+}
+
+extern "C" void* realloc(void* pointer, size_t size)
+{
+    count(size);
+    return __libc_realloc(pointer, size);
+}
+
+bool AllocationCounter::isSupported()
+{
+    return true;
+}
+
+qint64 AllocationCounter::getAllocations()
+{
+    return __sync_fetch_and_add(&allocations, 0);
+}
+
+qint64 AllocationCounter::getBytes()
+{
+    return __sync_fetch_and_add(&bytes, 0);
+}
+
+void AllocationCounter::excludeCurrentThread()
+{
+    excluded = true;
+}
+
+#else
+
+bool AllocationCounter::isSupported()
+{
+    return false;
+}
+
+qint64 AllocationCounter::getAllocations()
+{
+    return 0;
+}
+
+qint64 AllocationCounter::getBytes()
+{
+    return 0;
+}
+
+void AllocationCounter::excludeCurrentThread()
+{
+}
+
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <QtCore/QtGlobal>
+
+// Counts the heap allocations of the whole process, shared libraries included, by interposing malloc.
+// That needs glibc, elsewhere isSupported() is false and nothing is counted.
+class AllocationCounter
+{
+    public:
+        static bool isSupported();
+
+        static qint64 getAllocations();
+        static qint64 getBytes();
+
+        // Allocations made by the calling thread are not counted from now on, used by the load generator.
+        static void excludeCurrentThread();
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "OscArguments.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+// A subscription the way it worked before OscDeviceManager routed by path. Every subscription was connected
+// to the listener and compared the end of every message path with its own.
+class LinearSubscription : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit LinearSubscription(const QString& path, QObject* parent = 0)
+            : QObject(parent), path(path)
+        {
+        }
+
+        Q_SLOT void messageReceived(const QString& pattern, const OscArguments& arguments)
+        {
+            if (pattern.endsWith(this->path))
+                emit subscriptionReceived(this->path, arguments);
+        }
+
+        Q_SIGNAL void subscriptionReceived(const QString&, const OscArguments&);
+
+    private:
+        QString path;
+};
@@ -0,0 +1,344 @@
+#include "AllocationCounter.h"
+#include "LinearSubscription.h"
+#include "MessageCounter.h"
+#include "MessageSource.h"
+
+#include "OscArguments.h"
+#include "OscListener.h"
+#include "OscMessage.h"
+
+#include "OscDeviceManager.h"
+#include "OscSubscription.h"
+
+#include <osc/OscOutboundPacketStream.h>
+
+#include <QtCore/QAtomicInt>
+#include <QtCore/QByteArray>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QEventLoop>
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QUdpSocket>
+
+// Sends the packets round robin at a fixed rate, one message per datagram. Its own allocations are not counted.
+class LoadGenerator : public QThread
+{
+    public:
+        explicit LoadGenerator(const QList<QByteArray>& packets, quint16 port, int rate)
+            : packets(packets), port(port), rate(rate), stopped(0), sent(0), failures(0)
+        {
+        }
+
+        void stop() { this->stopped = 1; }
+        int getSent() const { return this->sent; }
+        int getFailures() const { return this->failures; }
+
+    protected:
+        virtual void run()
+        {
+            AllocationCounter::excludeCurrentThread();
+
+            QUdpSocket socket;
+            QHostAddress host(QHostAddress::LocalHost);
+            QElapsedTimer clock;
+            clock.start();
+
+            int index = 0;
+            qint64 sent = 0;
+            while (this->stopped == 0)
+            {
+                // Catch up with the schedule after every sleep, the rate holds even when the sleeps are coarse.
+                const qint64 due = clock.nsecsElapsed() / 1000 * this->rate / 1000000;
+                for (; sent < due; sent++)
+                {
+                    if (socket.writeDatagram(this->packets.at(index), host, this->port) < 0)
+                        this->failures.ref();
+
+                    index = (index + 1) % this->packets.count();
+                }
+
+                this->sent.fetchAndStoreRelease(static_cast<int>(sent));
+
+                QThread::usleep(1000);
+            }
+        }
+
+    private:
+        QList<QByteArray> packets;
+        quint16 port;
+        int rate;
+        QAtomicInt stopped;
+        QAtomicInt sent;
+        QAtomicInt failures;
+};
+
+// What a server sends for every layer on every frame, one second worth of frames at 50 fps.
+QList<QByteArray> createPackets(int layers)
+{
+    QList<QByteArray> packets;
+
+    char buffer[1024];
+    for (int frame = 0; frame < 50; frame++)
+    {
+        for (int layer = 1; layer <= layers; layer++)
+        {
+            const QString path = QString("/channel/1/stage/layer/%1/").arg(layer * 10);
+
+            QList<OscMessage> messages;
+            messages.append(OscMessage(path + "file/time").addFloat(frame / 50.0f).addFloat(60.0f));
+            messages.append(OscMessage(path + "file/frame").addInt64(frame).addInt64(3000));
+            messages.append(OscMessage(path + "file/path").addString(QString("AMB%1.mp4").arg(layer)));
+            messages.append(OscMessage(path + "paused").addBool(false));
+            messages.append(OscMessage(path + "loop").addBool(false));
+
+            foreach (const OscMessage& message, messages)
+            {
+                osc::OutboundPacketStream stream(buffer, sizeof(buffer));
+                message.write(stream);
+
+                packets.append(QByteArray(stream.Data(), stream.Size()));
+            }
+        }
+    }
+
+    return packets;
+}
+
+static const char* const LAYER_PATHS[] = { "file/time", "file/frame", "file/path", "paused", "loop" };
+
+// The paths a rundown subscribes to: every fourth is a layer of the server, the rest are remote triggers
+// that the server never sends.
+QStringList createSubscriptionPaths(int subscriptions, int layers)
+{
+    QStringList paths;
+    for (int i = 0; i < subscriptions; i++)
+    {
+        if (i % 4 == 0)
+            paths.append(QString("127.0.0.1/channel/1/stage/layer/%1/%2").arg((i / 4 % layers + 1) * 10).arg(LAYER_PATHS[i / 4 % 5]));
+        else
+            paths.append(QString("/control/item%1/play").arg(i));
+    }
+
+    return paths;
+}
+
+// Paths the way the listener emits them, prefixed with the address of the sender.
+QStringList createMessagePaths(int layers)
+{
+    QStringList paths;
+    for (int layer = 1; layer <= layers; layer++)
+    {
+        for (int i = 0; i < 5; i++)
+            paths.append(QString("127.0.0.1/channel/1/stage/layer/%1/%2").arg(layer * 10).arg(LAYER_PATHS[i]));
+    }
+
+    return paths;
+}
+
+// One second of messages at -rate through the exact path routing of OscDeviceManager and through the linear
+// scan every subscription did before, both driven by a signal the way OscListener drives them.
+bool benchmarkRouting(int rate, int subscriptions, int layers, QTextStream& stream)
+{
+    const QStringList subscriptionPaths = createSubscriptionPaths(subscriptions, layers);
+    const QStringList messagePaths = createMessagePaths(layers);
+
+    OscArguments arguments;
+    arguments.append(OscValue(0.5f));
+    arguments.append(OscValue(60.0f));
+
+    MessageCounter routedCounter;
+    MessageCounter scannedCounter;
+
+    MessageSource routedSource;
+    QObject::connect(&routedSource, SIGNAL(messageReceived(const QString&, const OscArguments&)),
+                     &OscDeviceManager::getInstance(), SLOT(dispatchMessage(const QString&, const OscArguments&)));
+
+    MessageSource scannedSource;
+
+    QList<OscSubscription*> routedSubscriptions;
+    QList<LinearSubscription*> scannedSubscriptions;
+    foreach (const QString& path, subscriptionPaths)
+    {
+        OscSubscription* routed = new OscSubscription(path);
+        QObject::connect(routed, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                         &routedCounter, SLOT(messageReceived(const QString&, const OscArguments&)));
+        routedSubscriptions.append(routed);
+
+        LinearSubscription* scanned = new LinearSubscription(path);
+        QObject::connect(&scannedSource, SIGNAL(messageReceived(const QString&, const OscArguments&)),
+                         scanned, SLOT(messageReceived(const QString&, const OscArguments&)));
+        QObject::connect(scanned, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                         &scannedCounter, SLOT(messageReceived(const QString&, const OscArguments&)));
+        scannedSubscriptions.append(scanned);
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < rate; i++)
+        routedSource.send(messagePaths.at(i % messagePaths.count()), arguments);
+
+    const qint64 routed = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int i = 0; i < rate; i++)
+        scannedSource.send(messagePaths.at(i % messagePaths.count()), arguments);
+
+    const qint64 scanned = timer.nsecsElapsed();
+
+    qDeleteAll(routedSubscriptions);
+    qDeleteAll(scannedSubscriptions);
+
+    // Time spent per second of messages, 1000 ms means the GUI thread does nothing else.
+    stream << QString("Routing %1 messages/s to %2 subscriptions: %3 ms/s by path (%4 ns per message), %5 ms/s scanned (%6 ns per message)")
+              .arg(rate).arg(subscriptions)
+              .arg(routed / 1000000.0, 0, 'f', 2).arg(routed / rate)
+              .arg(scanned / 1000000.0, 0, 'f', 2).arg(scanned / rate) << endl;
+
+    if (routedCounter.getMessages() != scannedCounter.getMessages())
+    {
+        stream << QString("Routing delivered %1 messages, the scan %2").arg(routedCounter.getMessages()).arg(scannedCounter.getMessages()) << endl;
+        return false;
+    }
+
+    return true;
+}
+
+void printUsage(QTextStream& stream)
+{
+    stream << "Usage: oscbenchmark [-rate 5000] [-seconds 10] [-warmup 2] [-layers 20] [-port 6251] [-interval 40]" << endl
+           << "                    [-subscriptions 1000]" << endl
+           << endl
+           << "Listens for OSC like the client does and sends itself -rate messages per second (file/time, file/frame," << endl
+           << "file/path, paused and loop for every layer), then reports the heap allocations of the receive path per" << endl
+           << "second and per message. With -rate 0 nothing is sent, drive the load with oscreplay -port instead." << endl
+           << "Afterwards a second of messages at -rate is routed to -subscriptions subscriptions by OscDeviceManager" << endl
+           << "and with the linear scan of every subscription it replaced." << endl;
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication application(argc, argv);
+    QTextStream stream(stdout);
+
+    QStringList arguments = application.arguments();
+    arguments.removeFirst();
+
+    int rate = 5000;
+    int seconds = 10;
+    int warmup = 2;
+    int layers = 20;
+    quint16 port = 6251;
+    int interval = 40;
+    int subscriptions = 1000;
+
+    for (int i = 0; i < arguments.count(); i++)
+    {
+        const QString& argument = arguments.at(i);
+        if (i + 1 >= arguments.count())
+        {
+            printUsage(stream);
+            return 1;
+        }
+
+        if (argument == "-rate")
+            rate = arguments.at(++i).toInt();
+        else if (argument == "-seconds")
+            seconds = arguments.at(++i).toInt();
+        else if (argument == "-warmup")
+            warmup = arguments.at(++i).toInt();
+        else if (argument == "-layers")
+            layers = arguments.at(++i).toInt();
+        else if (argument == "-port")
+            port = arguments.at(++i).toUShort();
+        else if (argument == "-interval")
+            interval = arguments.at(++i).toInt();
+        else if (argument == "-subscriptions")
+            subscriptions = arguments.at(++i).toInt();
+        else
+        {
+            printUsage(stream);
+            return 1;
+        }
+    }
+
+    if (rate < 0 || seconds < 1 || warmup < 0 || layers < 1 || port == 0 || interval < 1 || subscriptions < 0)
+    {
+        printUsage(stream);
+        return 1;
+    }
+
+    if (!AllocationCounter::isSupported())
+        stream << "Allocations are only counted with glibc, reporting the message rates only." << endl;
+
+    OscListener listener(interval);
+    if (!listener.addEndpoint("127.0.0.1", port))
+    {
+        stream << QString("Failed to listen on 127.0.0.1:%1").arg(port) << endl;
+        return 1;
+    }
+
+    MessageCounter counter;
+    QObject::connect(&listener, SIGNAL(messageReceived(const QString&, const OscArguments&)),
+                     &counter, SLOT(messageReceived(const QString&, const OscArguments&)));
+
+    listener.start();
+
+    LoadGenerator generator(createPackets(layers), port, rate);
+    if (rate > 0)
+        generator.start();
+
+    // The warm-up fills the path and string tables of the listener, after that the receive path should not allocate.
+    QElapsedTimer clock;
+    clock.start();
+    while (clock.elapsed() < warmup * 1000)
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+    const OscListener::OscListenerStatistics begin = listener.getStatistics();
+    const qint64 beginMessages = counter.getMessages();
+    const int beginSent = generator.getSent();
+    const qint64 beginAllocations = AllocationCounter::getAllocations();
+    const qint64 beginBytes = AllocationCounter::getBytes();
+
+    clock.restart();
+    while (clock.elapsed() < seconds * 1000)
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+
+    const qint64 allocations = AllocationCounter::getAllocations() - beginAllocations;
+    const qint64 bytes = AllocationCounter::getBytes() - beginBytes;
+    const qint64 elapsed = clock.elapsed();
+    const int sent = generator.getSent() - beginSent;
+    const qint64 messages = counter.getMessages() - beginMessages;
+    const OscListener::OscListenerStatistics end = listener.getStatistics();
+
+    generator.stop();
+    generator.wait();
+
+    const qint64 received = end.received - begin.received;
+
+    if (rate > 0)
+        stream << QString("Sent %1 messages/s, %2 failed").arg(sent * 1000 / elapsed).arg(generator.getFailures()) << endl;
+
+    stream << QString("Received %1 messages/s, delivered %2 messages/s (%3 coalesced, %4 dropped)")
+              .arg(received * 1000 / elapsed).arg(messages * 1000 / elapsed)
+              .arg(end.coalesced - begin.coalesced).arg(end.dropped - begin.dropped) << endl;
+
+    if (AllocationCounter::isSupported())
+    {
+        stream << QString("Allocated %1 times/s (%2 bytes/s), %3 per received message")
+                  .arg(allocations * 1000 / elapsed).arg(bytes * 1000 / elapsed)
+                  .arg((received > 0) ? static_cast<double>(allocations) / received : 0.0, 0, 'f', 3) << endl;
+    }
+
+    bool succeeded = rate == 0 || messages > 0;
+    if (rate > 0 && subscriptions > 0)
+        succeeded &= benchmarkRouting(rate, subscriptions, layers, stream);
+
+    // Nothing delivered means the listener is not working, fail so a CI run notices.
+    return succeeded ? 0 : 1;
+}
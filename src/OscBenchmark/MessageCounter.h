@@ -0,0 +1,42 @@
+#pragma once
+
+#include "OscArguments.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+// Stands in for the subscribers, reads the arguments the way the rundown widgets do.
+class MessageCounter : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit MessageCounter(QObject* parent = 0)
+            : QObject(parent), messages(0), arguments(0), checksum(0)
+        {
+        }
+
+        qint64 getMessages() const { return this->messages; }
+        qint64 getArguments() const { return this->arguments; }
+        qint64 getChecksum() const { return this->checksum; }
+
+        Q_SLOT void messageReceived(const QString& path, const OscArguments& arguments)
+        {
+            this->messages++;
+            this->arguments += arguments.count();
+            this->checksum += path.length();
+
+            for (int i = 0; i < arguments.count(); i++)
+            {
+                if (arguments[i].getType() == OscValue::String)
+                    this->checksum += arguments[i].toString().length();
+                else
+                    this->checksum += arguments[i].toInt();
+            }
+        }
+
+    private:
+        qint64 messages;
+        qint64 arguments;
+        qint64 checksum;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "OscArguments.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+// Stands in for OscListener, emits the messages the routing is timed with.
+class MessageSource : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit MessageSource(QObject* parent = 0)
+            : QObject(parent)
+        {
+        }
+
+        void send(const QString& path, const OscArguments& arguments)
+        {
+            emit messageReceived(path, arguments);
+        }
+
+        Q_SIGNAL void messageReceived(const QString&, const OscArguments&);
+};
@@ -0,0 +1,129 @@
+#include "OscCapture.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QUdpSocket>
+
+// QThread::usleep() is protected in Qt 4.
+class Sleeper : public QThread
+{
+    public:
+        static void sleep(unsigned long microseconds) { QThread::usleep(microseconds); }
+};
+
+void printUsage(QTextStream& stream)
+{
+    stream << "Usage: oscreplay <capture> [-speed 1|10|max] [-host 127.0.0.1] [-port 6250] [-loop 1]" << endl
+           << endl
+           << "Sends the packets of an OSC capture (shell -osccapture <capture>) to a running client, keeping" << endl
+           << "the recorded timing divided by the speed, or as fast as possible with max. The client sees the" << endl
+           << "packets coming from this machine, so the rundown needs a server configured on 127.0.0.1." << endl;
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication application(argc, argv);
+    QTextStream stream(stdout);
+
+    QStringList arguments = application.arguments();
+    arguments.removeFirst();
+
+    QString fileName;
+    double speed = 1; // Zero is as fast as possible.
+    QHostAddress host(QHostAddress::LocalHost);
+    quint16 port = 6250;
+    int loops = 1;
+
+    for (int i = 0; i < arguments.count(); i++)
+    {
+        const QString& argument = arguments.at(i);
+        if (argument.startsWith("-") && i + 1 >= arguments.count())
+        {
+            printUsage(stream);
+            return 1;
+        }
+
+        if (argument == "-speed")
+            speed = (arguments.at(++i) == "max") ? 0 : arguments.at(i).toDouble();
+        else if (argument == "-host")
+            host.setAddress(arguments.at(++i));
+        else if (argument == "-port")
+            port = arguments.at(++i).toUShort();
+        else if (argument == "-loop")
+            loops = arguments.at(++i).toInt();
+        else if (fileName.isEmpty())
+            fileName = argument;
+        else
+        {
+            printUsage(stream);
+            return 1;
+        }
+    }
+
+    if (fileName.isEmpty() || speed < 0 || port == 0 || loops < 1)
+    {
+        printUsage(stream);
+        return 1;
+    }
+
+    QUdpSocket socket;
+    QElapsedTimer clock;
+    QSet<quint32> senders;
+    qint64 packets = 0;
+    qint64 bytes = 0;
+    qint64 failures = 0;
+
+    clock.start();
+    for (int loop = 0; loop < loops; loop++)
+    {
+        OscCapture capture;
+        if (!capture.open(fileName, QIODevice::ReadOnly))
+        {
+            stream << QString("Failed to open %1: %2").arg(fileName).arg(capture.getErrorString()) << endl;
+            return 1;
+        }
+
+        // Every loop starts over from the time the previous one ended.
+        const qint64 begin = clock.nsecsElapsed() / 1000;
+
+        OscCapture::OscCapturePacket packet;
+        while (capture.read(packet))
+        {
+            if (speed > 0)
+            {
+                const qint64 due = begin + static_cast<qint64>(packet.timestamp / speed);
+                for (qint64 now = clock.nsecsElapsed() / 1000; now < due; now = clock.nsecsElapsed() / 1000)
+                    Sleeper::sleep(static_cast<unsigned long>(qMin(due - now, static_cast<qint64>(1000))));
+            }
+
+            if (socket.writeDatagram(packet.data, host, port) < 0)
+                failures++;
+
+            senders.insert(packet.address);
+            packets++;
+            bytes += packet.data.size();
+        }
+
+        capture.close();
+    }
+
+    const qint64 elapsed = qMax(clock.elapsed(), static_cast<qint64>(1));
+
+    stream << QString("Sent %1 packets (%2 bytes) in %3 ms, %4 packets/s, %5 failed")
+              .arg(packets).arg(bytes).arg(elapsed).arg(packets * 1000 / elapsed).arg(failures) << endl;
+
+    QStringList addresses;
+    foreach (quint32 address, senders)
+        addresses.append(QHostAddress(address).toString());
+
+    stream << QString("Recorded from: %1").arg(addresses.join(", ")) << endl;
+
+    return 0;
+}
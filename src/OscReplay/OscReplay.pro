@@ -0,0 +1,24 @@
+#-------------------------------------------------
+#
+# Plays back OSC captures made with: shell -osccapture <file>
+#
+#-------------------------------------------------
+
+QT += core network
+QT -= gui
+
+TARGET = oscreplay
+TEMPLATE = app
+
+CONFIG += console
+CONFIG -= app_bundle
+
+SOURCES += \
+    Main.cpp
+
+DEPENDPATH += $$OUT_PWD/../Osc $$PWD/../Osc
+INCLUDEPATH += $$OUT_PWD/../Osc $$PWD/../Osc
+win32:CONFIG(release, debug|release):LIBS += -L$$OUT_PWD/../Osc/release/ -losc
+else:win32:CONFIG(debug, debug|release):LIBS += -L$$OUT_PWD/../Osc/debug/ -losc
+else:macx:LIBS += -L$$OUT_PWD/../Osc/ -losc
+else:unix:LIBS += -L$$OUT_PWD/../Osc/ -losc
@@ -172,8 +172,17 @@ int main(int argc, char* argv[])
     TriCasterDeviceManager::getInstance().initialize();
     OscDeviceManager::getInstance().initialize();
 
+    // Record the incoming OSC traffic, it can be played back with the oscreplay tool.
+    if (application.arguments().contains("-osccapture"))
+    {
+        int i = application.arguments().indexOf("-osccapture");
+        if (application.arguments().count() > i + 1)
+            OscDeviceManager::getInstance().getOscListener()->startCapture(application.arguments().at(i + 1));
+    }
+
     int returnValue = application.exec();
 
+    LibraryManager::getInstance().uninitialize();
     EventManager::getInstance().uninitialize();
     DatabaseManager::getInstance().uninitialize();
     GpiManager::getInstance().uninitialize();
@@ -181,7 +190,6 @@ int main(int argc, char* argv[])
     TriCasterDeviceManager::getInstance().uninitialize();
     AtemDeviceManager::getInstance().uninitialize();
     DeviceManager::getInstance().uninitialize();
-    LibraryManager::getInstance().uninitialize();
 
     return returnValue;
 }
@@ -9,4 +9,8 @@ SUBDIRS += \
     Osc \
     Core \
     Widgets \
-    Shell
+    Shell \
+    OscReplay \
+    OscBenchmark \
+    LibraryBenchmark \
+    AmcpBenchmark
@@ -1,7 +1,6 @@
 #include "NtfcDevice.h"
 
 #include <QtCore/QStringList>
-#include <QtCore/QTimer>
 
 NtfcDevice::NtfcDevice(const QString& address, int port, QObject* parent)
     : QObject(parent),
@@ -22,9 +21,11 @@ void NtfcDevice::connectDevice()
     if (this->connected)
         return;
 
-    this->socket->connectToHost(this->address, this->port);
+    // Drop an attempt that is still pending, retries are up to the owner.
+    if (this->socket->state() != QAbstractSocket::UnconnectedState)
+        this->socket->abort();
 
-    QTimer::singleShot(5000, this, SLOT(connectDevice()));
+    this->socket->connectToHost(this->address, this->port);
 }
 
 void NtfcDevice::disconnectDevice()
@@ -53,8 +54,6 @@ void NtfcDevice::setDisconnected()
     this->command = NtfcDevice::CONNECTIONSTATE;
 
     sendNotification();
-
-    QTimer::singleShot(5000, this, SLOT(connectNtfcDevice()));
 }
 
 bool NtfcDevice::isConnected() const
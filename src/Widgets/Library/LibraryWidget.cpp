@@ -5,6 +5,7 @@
 #include "DeviceManager.h"
 #include "DatabaseManager.h"
 #include "EventManager.h"
+#include "LibraryIndex.h"
 #include "DeviceFilterWidget.h"
 #include "Events/AddPresetItemEvent.h"
 #include "Events/ExportPresetEvent.h"
@@ -26,6 +27,7 @@
 #include <QtGui/QIcon>
 #include <QtGui/QFileDialog>
 #include <QtGui/QKeyEvent>
+#include <QtGui/QScrollBar>
 #include <QtGui/QTreeWidgetItem>
 #include <QtGui/QStandardItemModel>
 
@@ -98,9 +100,78 @@ LibraryWidget::LibraryWidget(QWidget* parent)
     QObject::connect(&EventManager::getInstance(), SIGNAL(importPreset(const ImportPresetEvent&)), this, SLOT(importPreset(const ImportPresetEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(exportPreset(const ExportPresetEvent&)), this, SLOT(exportPreset(const ExportPresetEvent&)));
 
+    setupPage(this->treeWidgetAudio, "AUDIO", ":/Graphics/Images/AudioSmall.png");
+    setupPage(this->treeWidgetImage, "STILL", ":/Graphics/Images/StillSmall.png");
+    setupPage(this->treeWidgetVideo, "MOVIE", ":/Graphics/Images/MovieSmall.png");
+    setupPage(this->treeWidgetTemplate, "TEMPLATE", ":/Graphics/Images/TemplateSmall.png");
+    setupPage(this->treeWidgetData, "DATA", ":/Graphics/Images/DataSmall.png");
+
+    // Filter while typing, once the typing pauses. Return still filters right away.
+    this->filterTimer.setSingleShot(true);
+    this->filterTimer.setInterval(Library::FILTER_DELAY);
+    QObject::connect(&this->filterTimer, SIGNAL(timeout()), this, SLOT(filterLibrary()));
+    QObject::connect(this->lineEditFilter, SIGNAL(textChanged(const QString&)), &this->filterTimer, SLOT(start()));
+
     QTimer::singleShot(0, this, SLOT(loadLibrary()));
 }
 
+void LibraryWidget::setupPage(QTreeWidget* treeWidget, const QString& type, const QString& icon)
+{
+    LibraryPage page = { type, icon, 0 };
+    this->pages.insert(treeWidget, page);
+
+    QObject::connect(treeWidget->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(scrollLibrary(int)));
+}
+
+void LibraryWidget::loadPage(QTreeWidget* treeWidget, bool reset)
+{
+    LibraryPage& page = this->pages[treeWidget];
+
+    if (reset)
+    {
+        treeWidget->clear();
+        treeWidget->clearSelection();
+    }
+
+    const QList<LibraryModel> models = LibraryIndex::getInstance().search(page.type, this->lineEditFilter->text(),
+                                                                          dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter(),
+                                                                          treeWidget->topLevelItemCount(), Library::PAGE_SIZE, page.total);
+
+    QList<QTreeWidgetItem*> items;
+    foreach (const LibraryModel& model, models)
+    {
+        QTreeWidgetItem* widget = new QTreeWidgetItem();
+        widget->setIcon(0, QIcon(page.icon));
+        widget->setText(0, model.getName());
+        widget->setText(1, QString("%1").arg(model.getId()));
+        widget->setText(2, model.getLabel());
+        widget->setText(3, model.getDeviceName());
+        widget->setText(4, model.getType());
+        widget->setText(5, QString("%1").arg(model.getThumbnailId()));
+        widget->setText(6, model.getTimecode());
+
+        items.push_back(widget);
+    }
+
+    treeWidget->addTopLevelItems(items);
+}
+
+void LibraryWidget::scrollLibrary(int value)
+{
+    for (QMap<QTreeWidget*, LibraryPage>::const_iterator page = this->pages.constBegin(); page != this->pages.constEnd(); ++page)
+    {
+        QScrollBar* scrollBar = page.key()->verticalScrollBar();
+        if (scrollBar != sender())
+            continue;
+
+        // Add the next page before the end of the list is reached.
+        if (value >= scrollBar->maximum() - scrollBar->pageStep() && page.key()->topLevelItemCount() < page.value().total)
+            loadPage(page.key(), false);
+
+        break;
+    }
+}
+
 void LibraryWidget::setupTools()
 {
     QTreeWidgetItem* widgetAudio = new QTreeWidgetItem(this->treeWidgetTool->topLevelItem(0));
@@ -505,128 +576,27 @@ void LibraryWidget::setupUiMenu()
 
 void LibraryWidget::mediaChanged(const MediaChangedEvent& event)
 {
-    // TODO: Only add / remove necessary items.
-    this->treeWidgetAudio->clear();
-    this->treeWidgetImage->clear();
-    this->treeWidgetVideo->clear();
-    this->treeWidgetAudio->clearSelection();
-    this->treeWidgetImage->clearSelection();
-    this->treeWidgetVideo->clearSelection();
-
-    QList<LibraryModel> models;
-    if (this->lineEditFilter->text().isEmpty() &&  dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter().count() == 0)
-        models = DatabaseManager::getInstance().getLibraryMedia();
-    else
-        models = DatabaseManager::getInstance().getLibraryMediaByFilter(this->lineEditFilter->text(), dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter());
+    loadPage(this->treeWidgetAudio, true);
+    loadPage(this->treeWidgetImage, true);
+    loadPage(this->treeWidgetVideo, true);
 
-    if (models.count() > 0)
-    {
-        foreach (LibraryModel model, models)
-        {
-            if (model.getType() == "AUDIO")
-            {
-                QTreeWidgetItem* widget = new QTreeWidgetItem(this->treeWidgetAudio);
-                widget->setIcon(0, QIcon(":/Graphics/Images/AudioSmall.png"));
-                widget->setText(0, model.getName());
-                widget->setText(1, QString("%1").arg(model.getId()));
-                widget->setText(2, model.getLabel());
-                widget->setText(3, model.getDeviceName());
-                widget->setText(4, model.getType());
-                widget->setText(5, QString("%1").arg(model.getThumbnailId()));
-                widget->setText(6, model.getTimecode());
-            }
-            else if (model.getType() == "STILL")
-            {
-                QTreeWidgetItem* widget = new QTreeWidgetItem(this->treeWidgetImage);
-                widget->setIcon(0, QIcon(":/Graphics/Images/StillSmall.png"));
-                widget->setText(0, model.getName());
-                widget->setText(1, QString("%1").arg(model.getId()));
-                widget->setText(2, model.getLabel());
-                widget->setText(3, model.getDeviceName());
-                widget->setText(4, model.getType());
-                widget->setText(5, QString("%1").arg(model.getThumbnailId()));
-                widget->setText(6, model.getTimecode());
-            }
-            else if (model.getType() == "MOVIE")
-            {
-                QTreeWidgetItem* widget = new QTreeWidgetItem(this->treeWidgetVideo);
-                widget->setIcon(0, QIcon(":/Graphics/Images/MovieSmall.png"));
-                widget->setText(0, model.getName());
-                widget->setText(1, QString("%1").arg(model.getId()));
-                widget->setText(2, model.getLabel());
-                widget->setText(3, model.getDeviceName());
-                widget->setText(4, model.getType());
-                widget->setText(5, QString("%1").arg(model.getThumbnailId()));
-                widget->setText(6, model.getTimecode());
-            }
-        }
-    }
-
-    this->toolBoxLibrary->setItemText(Library::AUDIO_PAGE_INDEX, QString("Audio (%1)").arg(this->treeWidgetAudio->topLevelItemCount()));
-    this->toolBoxLibrary->setItemText(Library::STILL_PAGE_INDEX, QString("Images (%1)").arg(this->treeWidgetImage->topLevelItemCount()));
-    this->toolBoxLibrary->setItemText(Library::MOVIE_PAGE_INDEX, QString("Videos (%1)").arg(this->treeWidgetVideo->topLevelItemCount()));
+    this->toolBoxLibrary->setItemText(Library::AUDIO_PAGE_INDEX, QString("Audio (%1)").arg(this->pages.value(this->treeWidgetAudio).total));
+    this->toolBoxLibrary->setItemText(Library::STILL_PAGE_INDEX, QString("Images (%1)").arg(this->pages.value(this->treeWidgetImage).total));
+    this->toolBoxLibrary->setItemText(Library::MOVIE_PAGE_INDEX, QString("Videos (%1)").arg(this->pages.value(this->treeWidgetVideo).total));
 }
 
 void LibraryWidget::templateChanged(const TemplateChangedEvent& event)
 {
-    // TODO: Only add / remove necessary items.
-    this->treeWidgetTemplate->clear();
-    this->treeWidgetTemplate->clearSelection();
-
-    QList<LibraryModel> models;
-    if (this->lineEditFilter->text().isEmpty() &&  dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter().count() == 0)
-        models = DatabaseManager::getInstance().getLibraryTemplate();
-    else
-        models = DatabaseManager::getInstance().getLibraryTemplateByFilter(this->lineEditFilter->text(), dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter());
-
-    if (models.count() > 0)
-    {
-        foreach (LibraryModel model, models)
-        {
-            QTreeWidgetItem* widget = new QTreeWidgetItem(this->treeWidgetTemplate);
-            widget->setIcon(0, QIcon(":/Graphics/Images/TemplateSmall.png"));
-            widget->setText(0, model.getName());
-            widget->setText(1, QString("%1").arg(model.getId()));
-            widget->setText(2, model.getLabel());
-            widget->setText(3, model.getDeviceName());
-            widget->setText(4, model.getType());
-            widget->setText(5, QString("%1").arg(model.getThumbnailId()));
-            widget->setText(6, model.getTimecode());
-        }
-    }
+    loadPage(this->treeWidgetTemplate, true);
 
-    this->toolBoxLibrary->setItemText(Library::TEMPLATE_PAGE_INDEX, QString("Templates (%1)").arg(this->treeWidgetTemplate->topLevelItemCount()));
+    this->toolBoxLibrary->setItemText(Library::TEMPLATE_PAGE_INDEX, QString("Templates (%1)").arg(this->pages.value(this->treeWidgetTemplate).total));
 }
 
 void LibraryWidget::dataChanged(const DataChangedEvent& event)
 {
-    // TODO: Only add / remove necessary items.
-    this->treeWidgetData->clear();
-    this->treeWidgetData->clearSelection();
+    loadPage(this->treeWidgetData, true);
 
-    QList<LibraryModel> models;
-    if (this->lineEditFilter->text().isEmpty() &&  dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter().count() == 0)
-        models = DatabaseManager::getInstance().getLibraryData();
-    else
-        models = DatabaseManager::getInstance().getLibraryDataByFilter(this->lineEditFilter->text(), dynamic_cast<DeviceFilterWidget*>(this->widgetDeviceFilter)->getDeviceFilter());
-
-    if (models.count() > 0)
-    {
-        foreach (LibraryModel model, models)
-        {
-            QTreeWidgetItem* widget = new QTreeWidgetItem(this->treeWidgetData);
-            widget->setIcon(0, QIcon(":/Graphics/Images/DataSmall.png"));
-            widget->setText(0, model.getName());
-            widget->setText(1, QString("%1").arg(model.getId()));
-            widget->setText(2, model.getLabel());
-            widget->setText(3, model.getDeviceName());
-            widget->setText(4, model.getType());
-            widget->setText(5, QString("%1").arg(model.getThumbnailId()));
-            widget->setText(6, model.getTimecode());
-        }
-    }
-
-    this->toolBoxLibrary->setItemText(Library::DATA_PAGE_INDEX, QString("Stored Data (%1)").arg(this->treeWidgetData->topLevelItemCount()));
+    this->toolBoxLibrary->setItemText(Library::DATA_PAGE_INDEX, QString("Stored Data (%1)").arg(this->pages.value(this->treeWidgetData).total));
 }
 
 void LibraryWidget::presetChanged(const PresetChangedEvent& event)
@@ -854,6 +824,8 @@ void LibraryWidget::contextMenuPresetTriggered(QAction* action)
 
 void LibraryWidget::filterLibrary()
 {
+    this->filterTimer.stop();
+
     EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
     EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
     EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
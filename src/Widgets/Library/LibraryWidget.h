@@ -13,11 +13,14 @@
 #include "Events/Inspector/TemplateChangedEvent.h"
 #include "Models/LibraryModel.h"
 
+#include <QtCore/QMap>
 #include <QtCore/QPoint>
+#include <QtCore/QTimer>
 
 #include <QtGui/QAction>
 #include <QtGui/QMenu>
 #include <QtGui/QKeyEvent>
+#include <QtGui/QTreeWidget>
 #include <QtGui/QWidget>
 
 class WIDGETS_EXPORT LibraryWidget : public QWidget, Ui::LibraryWidget
@@ -28,18 +31,31 @@ class WIDGETS_EXPORT LibraryWidget : public QWidget, Ui::LibraryWidget
         explicit LibraryWidget(QWidget* parent = 0);
 
     private:
+        // What a library list shows, it is filled a page at a time from the search index.
+        struct LibraryPage
+        {
+            QString type;
+            QString icon;
+            int total;
+        };
+
         QMenu* contextMenu;
         QMenu* contextMenuImage;
         QMenu* contextMenuPreset;
         QMenu* contextMenuData;
         QSharedPointer<LibraryModel> model;
+        QTimer filterTimer;
+        QMap<QTreeWidget*, LibraryPage> pages;
 
         void setupTools();
         void setupUiMenu();
+        void setupPage(QTreeWidget* treeWidget, const QString& type, const QString& icon);
+        void loadPage(QTreeWidget* treeWidget, bool reset);
 
         Q_SLOT void loadLibrary();
         Q_SLOT void toggleExpandItem(QTreeWidgetItem*, int);
         Q_SLOT void filterLibrary();
+        Q_SLOT void scrollLibrary(int);
         Q_SLOT void contextMenuTriggered(QAction*);
         Q_SLOT void contextMenuImageTriggered(QAction*);
         Q_SLOT void contextMenuPresetTriggered(QAction*);
@@ -1,6 +1,7 @@
 #include "MainWindow.h"
 #include "AboutDialog.h"
 #include "HelpDialog.h"
+#include "ServerMonitorDialog.h"
 #include "SettingsDialog.h"
 
 #include "Version.h"
@@ -78,6 +79,8 @@ void MainWindow::setupMenu()
 
     this->viewMenu = new QMenu(this);
     this->viewMenu->addAction("Toggle Fullscreen", this, SLOT(toggleFullscreen()), QKeySequence::fromString("Ctrl+F"));
+    this->viewMenu->addSeparator();
+    this->viewMenu->addAction("Server Monitor...", this, SLOT(showServerMonitorDialog()));
 
     this->libraryMenu = new QMenu(this);
     this->libraryMenu->addAction("Refresh Library", this, SLOT(refreshLibrary()), QKeySequence::fromString("Ctrl+R"));
@@ -296,6 +299,14 @@ void MainWindow::showHelpDialog()
     dialog->exec();
 }
 
+void MainWindow::showServerMonitorDialog()
+{
+    // Not modal, the operator keeps it open next to the rundown.
+    ServerMonitorDialog* dialog = new ServerMonitorDialog(this);
+    dialog->setAttribute(Qt::WA_DeleteOnClose);
+    dialog->show();
+}
+
 void MainWindow::showSettingsDialog()
 {
     // Reset inspector panel.
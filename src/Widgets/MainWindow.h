@@ -66,6 +66,7 @@ class WIDGETS_EXPORT MainWindow : public QMainWindow, Ui::MainWindow
         Q_SLOT void showAboutDialog();
         Q_SLOT void showHelpDialog();
         Q_SLOT void showSettingsDialog();
+        Q_SLOT void showServerMonitorDialog();
         Q_SLOT void toggleFullscreen();
         Q_SLOT void toggleCompactView();
         Q_SLOT void refreshLibrary();
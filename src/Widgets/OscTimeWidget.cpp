@@ -10,7 +10,7 @@
 
 OscTimeWidget::OscTimeWidget(QWidget* parent)
     : QWidget(parent),
-      fps(0), paused(false), timestamp(0), startTime(""), reverseOscTime(false)
+      fps(0), currentFrame(-1), seek(-1), length(-1), paused(false), timestamp(0), startTime(""), reverseOscTime(false)
 {
     setupUi(this);
 
@@ -40,6 +40,9 @@ void OscTimeWidget::reset()
         return;
 
     this->fps = 0;
+    this->currentFrame = -1;
+    this->seek = -1;
+    this->length = -1;
     this->timestamp = 0;
     this->progressBarOscTime->reset();
 
@@ -62,9 +65,15 @@ void OscTimeWidget::setTime(int currentFrame)
 
     this->setVisible(true);
 
-    double currentTime = currentFrame * (1.0 / this->fps);
+    // Only format the timecode when it has changed.
+    if (currentFrame != this->currentFrame)
+    {
+        this->currentFrame = currentFrame;
+
+        double currentTime = currentFrame * (1.0 / this->fps);
 
-    this->labelOscTime->setText(convertToTimecode(currentTime));
+        this->labelOscTime->setText(convertToTimecode(currentTime));
+    }
 
     if (this->timestamp == 0) // First time.
         QTimer::singleShot(500, this, SLOT(checkState()));
@@ -79,6 +88,7 @@ void OscTimeWidget::setStartTime(const QString& startTime, bool reverseOscTime)
 
     this->startTime = startTime;
     this->reverseOscTime = reverseOscTime;
+    this->currentFrame = -1;
     this->labelOscTime->setText(this->startTime);
 
     if (this->reverseOscTime)
@@ -94,6 +104,12 @@ void OscTimeWidget::setInOutTime(int seek, int length)
 
     this->setVisible(true);
 
+    if (seek == this->seek && length == this->length)
+        return;
+
+    this->seek = seek;
+    this->length = length;
+
     double inTime = seek * (1.0 / this->fps);
     double outTime = (seek + length) * (1.0 / this->fps);
 
@@ -112,12 +128,19 @@ void OscTimeWidget::setProgress(int currentFrame)
 
     this->progressBarOscTime->setVisible(true);
     this->progressBarOscTime->setValue(currentFrame);
-    this->progressBarOscTime->update();
 }
 
 void OscTimeWidget::setFramesPerSecond(int fps)
 {
+    if (fps == this->fps)
+        return;
+
     this->fps = fps;
+
+    // The timecodes depend on the frame rate.
+    this->currentFrame = -1;
+    this->seek = -1;
+    this->length = -1;
 }
 
 void OscTimeWidget::setPaused(bool paused)
@@ -25,6 +25,9 @@ class WIDGETS_EXPORT OscTimeWidget : public QWidget, Ui::OscTimeWidget
 
     private:
         int fps;
+        int currentFrame;
+        int seek;
+        int length;
         bool paused;
         qint64 timestamp;
         QString startTime;
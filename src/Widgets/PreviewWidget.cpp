@@ -48,17 +48,17 @@ void PreviewWidget::setThumbnail()
     QString name = this->model->getName();
     QString deviceName = this->model->getDeviceName();
 
-    QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
+    QByteArray data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
 
     /*
-    QString data = DatabaseManager::getInstance().getThumbnailById(thumbnailId).getData();
+    QByteArray data = DatabaseManager::getInstance().getThumbnailById(thumbnailId).getData();
     if (data.isEmpty())
         data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(name, deviceName).getData();
     */
 
     if (!data.isEmpty())
     {
-        this->image.loadFromData(QByteArray::fromBase64(data.toAscii()), "PNG");
+        this->image.loadFromData(data, "PNG");
 
         if (this->previewAlpha)
             this->labelPreview->setPixmap(QPixmap::fromImage(this->image.alphaChannel()));
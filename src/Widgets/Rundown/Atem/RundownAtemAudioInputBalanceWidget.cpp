@@ -260,23 +260,21 @@ void RundownAtemAudioInputBalanceWidget::configureOscSubscriptions()
     if (AtemDeviceManager::getInstance().getDeviceByName(this->model.getDeviceName()) == NULL)
         return;
 
-    if (this->playControlSubscription != NULL)
-        this->playControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->updateControlSubscription != NULL)
-        this->updateControlSubscription->disconnect(); // Disconnect all events.
+    // Deleting a subscription unsubscribes it.
+    delete this->playControlSubscription;
+    delete this->updateControlSubscription;
 
     QString playControlFilter = Osc::DEFAULT_PLAY_CONTROL_FILTER;
     playControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->playControlSubscription = new OscSubscription(playControlFilter, this);
-    QObject::connect(this->playControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(playControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->playControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(playControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString updateControlFilter = Osc::DEFAULT_UPDATE_CONTROL_FILTER;
     updateControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->updateControlSubscription = new OscSubscription(updateControlFilter, this);
-    QObject::connect(this->updateControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(updateControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->updateControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(updateControlSubscriptionReceived(const QString&, const OscArguments&)));
 }
 
 void RundownAtemAudioInputBalanceWidget::allowGpiChanged(bool allowGpi)
@@ -309,13 +307,13 @@ void RundownAtemAudioInputBalanceWidget::deviceAdded(AtemDevice& device)
     checkDeviceConnection();
 }
 
-void RundownAtemAudioInputBalanceWidget::playControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAtemAudioInputBalanceWidget::playControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Play);
 }
 
-void RundownAtemAudioInputBalanceWidget::updateControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAtemAudioInputBalanceWidget::updateControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Update);
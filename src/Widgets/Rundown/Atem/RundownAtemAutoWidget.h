@@ -81,8 +81,8 @@ class WIDGETS_EXPORT RundownAtemAutoWidget : public QWidget, Ui::RundownAtemAuto
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void deviceConnectionStateChanged(AtemDevice&);
         Q_SLOT void deviceAdded(AtemDevice&);
-        Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void updateControlSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void playControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void updateControlSubscriptionReceived(const QString&, const OscArguments&);
         Q_SLOT void preview(const PreviewEvent&);
         Q_SLOT void labelChanged(const LabelChangedEvent&);
         Q_SLOT void atemDeviceChanged(const AtemDeviceChangedEvent&);
@@ -247,7 +247,10 @@ bool RundownAudioWidget::executeCommand(Playout::PlayoutType::Type type)
                 this->executeTimer.setInterval(this->command.getDelay());
             }
 
-            this->executeTimer.start();
+            if (this->executeTimer.interval() == 0 && DeviceManager::getInstance().isDeferringMixer())
+                executePlay();
+            else
+                this->executeTimer.start();
         }
     }
     else if (type == Playout::PlayoutType::Next && this->command.getTriggerOnNext())
@@ -277,13 +280,9 @@ void RundownAudioWidget::executeStop()
     if (device != NULL && device->isConnected())
         device->stopAudio(this->command.getChannel(), this->command.getVideolayer());
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
             deviceShadow->stopAudio(this->command.getChannel(), this->command.getVideolayer());
     }
 
@@ -309,13 +308,9 @@ void RundownAudioWidget::executePlay()
         }
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             if (this->loaded)
             {
@@ -349,13 +344,9 @@ void RundownAudioWidget::executePause()
             device->pauseAudio(this->command.getChannel(), this->command.getVideolayer());
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             if (this->paused)
                 deviceShadow->playAudio(this->command.getChannel(), this->command.getVideolayer());
@@ -377,13 +368,9 @@ void RundownAudioWidget::executeLoad()
                           this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             deviceShadow->loadAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
                                     this->command.getTransition(), this->command.getDuration(), this->command.getTween(),
@@ -404,13 +391,9 @@ void RundownAudioWidget::executeClearVideolayer()
     if (device != NULL && device->isConnected())
         device->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
             deviceShadow->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
     }
 
@@ -430,13 +413,9 @@ void RundownAudioWidget::executeClearChannel()
         device->clearMixerChannel(this->command.getChannel());
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             deviceShadow->clearChannel(this->command.getChannel());
             deviceShadow->clearMixerChannel(this->command.getChannel());
@@ -472,86 +451,70 @@ void RundownAudioWidget::configureOscSubscriptions()
     if (DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName()) == NULL)
         return;
 
-    if (this->stopControlSubscription != NULL)
-        this->stopControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->playControlSubscription != NULL)
-        this->playControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->loadControlSubscription != NULL)
-        this->loadControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pauseControlSubscription != NULL)
-        this->pauseControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->nextControlSubscription != NULL)
-        this->nextControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->updateControlSubscription != NULL)
-        this->updateControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearControlSubscription != NULL)
-        this->clearControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearVideolayerControlSubscription != NULL)
-        this->clearVideolayerControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearChannelControlSubscription != NULL)
-        this->clearChannelControlSubscription->disconnect(); // Disconnect all events.
+    // Deleting a subscription unsubscribes it.
+    delete this->stopControlSubscription;
+    delete this->playControlSubscription;
+    delete this->loadControlSubscription;
+    delete this->pauseControlSubscription;
+    delete this->nextControlSubscription;
+    delete this->updateControlSubscription;
+    delete this->clearControlSubscription;
+    delete this->clearVideolayerControlSubscription;
+    delete this->clearChannelControlSubscription;
 
     QString stopControlFilter = Osc::DEFAULT_STOP_CONTROL_FILTER;
     stopControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->stopControlSubscription = new OscSubscription(stopControlFilter, this);
-    QObject::connect(this->stopControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(stopControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->stopControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(stopControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString playControlFilter = Osc::DEFAULT_PLAY_CONTROL_FILTER;
     playControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->playControlSubscription = new OscSubscription(playControlFilter, this);
-    QObject::connect(this->playControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(playControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->playControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(playControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString loadControlFilter = Osc::DEFAULT_LOAD_CONTROL_FILTER;
     loadControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->loadControlSubscription = new OscSubscription(loadControlFilter, this);
-    QObject::connect(this->loadControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(loadControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->loadControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(loadControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString pauseControlFilter = Osc::DEFAULT_PAUSE_CONTROL_FILTER;
     pauseControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->pauseControlSubscription = new OscSubscription(pauseControlFilter, this);
-    QObject::connect(this->pauseControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pauseControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->pauseControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(pauseControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString nextControlFilter = Osc::DEFAULT_NEXT_CONTROL_FILTER;
     nextControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->nextControlSubscription = new OscSubscription(nextControlFilter, this);
-    QObject::connect(this->nextControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(nextControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->nextControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(nextControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString updateControlFilter = Osc::DEFAULT_UPDATE_CONTROL_FILTER;
     updateControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->updateControlSubscription = new OscSubscription(updateControlFilter, this);
-    QObject::connect(this->updateControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(updateControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->updateControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(updateControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearControlFilter = Osc::DEFAULT_CLEAR_CONTROL_FILTER;
     clearControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearControlSubscription = new OscSubscription(clearControlFilter, this);
-    QObject::connect(this->clearControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearVideolayerControlFilter = Osc::DEFAULT_CLEAR_VIDEOLAYER_CONTROL_FILTER;
     clearVideolayerControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearVideolayerControlSubscription = new OscSubscription(clearVideolayerControlFilter, this);
-    QObject::connect(this->clearVideolayerControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearVideolayerControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearVideolayerControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearVideolayerControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearChannelControlFilter = Osc::DEFAULT_CLEAR_CHANNEL_CONTROL_FILTER;
     clearChannelControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearChannelControlSubscription = new OscSubscription(clearChannelControlFilter, this);
-    QObject::connect(this->clearChannelControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearChannelControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearChannelControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearChannelControlSubscriptionReceived(const QString&, const OscArguments&)));
 }
 
 void RundownAudioWidget::channelChanged(int channel)
@@ -604,55 +567,55 @@ void RundownAudioWidget::deviceAdded(CasparDevice& device)
     checkDeviceConnection();
 }
 
-void RundownAudioWidget::stopControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::stopControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Stop);
 }
 
-void RundownAudioWidget::playControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::playControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Play);
 }
 
-void RundownAudioWidget::loadControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::loadControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Load);
 }
 
-void RundownAudioWidget::pauseControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::pauseControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Pause);
 }
 
-void RundownAudioWidget::nextControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::nextControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Next);
 }
 
-void RundownAudioWidget::updateControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::updateControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Update);
 }
 
-void RundownAudioWidget::clearControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::clearControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Clear);
 }
 
-void RundownAudioWidget::clearVideolayerControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::clearVideolayerControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::ClearVideolayer);
 }
 
-void RundownAudioWidget::clearChannelControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownAudioWidget::clearChannelControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::ClearChannel);
@@ -100,15 +100,15 @@ class WIDGETS_EXPORT RundownAudioWidget : public QWidget, Ui::RundownAudioWidget
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
-        Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void loadControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pauseControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void nextControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void updateControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearVideolayerControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearChannelControlSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void stopControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void playControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void loadControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void pauseControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void nextControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void updateControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearVideolayerControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearChannelControlSubscriptionReceived(const QString&, const OscArguments&);
         Q_SLOT void labelChanged(const LabelChangedEvent&);
         Q_SLOT void targetChanged(const TargetChangedEvent&);
         Q_SLOT void deviceChanged(const DeviceChangedEvent&);
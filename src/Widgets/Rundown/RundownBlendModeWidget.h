@@ -96,12 +96,12 @@ class WIDGETS_EXPORT RundownBlendModeWidget : public QWidget, Ui::RundownBlendMo
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
-        Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void updateControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearVideolayerControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearChannelControlSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void stopControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void playControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void updateControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearVideolayerControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearChannelControlSubscriptionReceived(const QString&, const OscArguments&);
         Q_SLOT void preview(const PreviewEvent&);
         Q_SLOT void labelChanged(const LabelChangedEvent&);
         Q_SLOT void deviceChanged(const DeviceChangedEvent&);
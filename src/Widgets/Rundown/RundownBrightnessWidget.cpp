@@ -234,7 +234,10 @@ bool RundownBrightnessWidget::executeCommand(Playout::PlayoutType::Type type)
                     this->executeTimer.setInterval(this->command.getDelay());
                 }
 
-                this->executeTimer.start();
+                if (this->executeTimer.interval() == 0 && DeviceManager::getInstance().isDeferringMixer())
+                    executePlay();
+                else
+                    this->executeTimer.start();
             }
     }
     else if (type == Playout::PlayoutType::Clear)
@@ -258,13 +261,9 @@ void RundownBrightnessWidget::executeStop()
     if (device != NULL && device->isConnected())
         device->setBrightness(this->command.getChannel(), this->command.getVideolayer(), 1);
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
             deviceShadow->setBrightness(this->command.getChannel(), this->command.getVideolayer(), 1);
     }
 }
@@ -276,13 +275,9 @@ void RundownBrightnessWidget::executePlay()
         device->setBrightness(this->command.getChannel(), this->command.getVideolayer(), this->command.getBrightness(),
                               this->command.getDuration(), this->command.getTween(), this->command.getDefer());
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
             deviceShadow->setBrightness(this->command.getChannel(), this->command.getVideolayer(), this->command.getBrightness(),
                                         this->command.getDuration(), this->command.getTween(), this->command.getDefer());
     }
@@ -296,13 +291,9 @@ void RundownBrightnessWidget::executeClearVideolayer()
     if (device != NULL && device->isConnected())
         device->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
             deviceShadow->clearMixerVideolayer(this->command.getChannel(), this->command.getVideolayer());
     }
 }
@@ -318,13 +309,9 @@ void RundownBrightnessWidget::executeClearChannel()
         device->clearMixerChannel(this->command.getChannel());
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             deviceShadow->clearChannel(this->command.getChannel());
             deviceShadow->clearMixerChannel(this->command.getChannel());
@@ -371,59 +358,49 @@ void RundownBrightnessWidget::configureOscSubscriptions()
     if (DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName()) == NULL)
         return;
 
-    if (this->stopControlSubscription != NULL)
-        this->stopControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->playControlSubscription != NULL)
-        this->playControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->updateControlSubscription != NULL)
-        this->updateControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearControlSubscription != NULL)
-        this->clearControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearVideolayerControlSubscription != NULL)
-        this->clearVideolayerControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearChannelControlSubscription != NULL)
-        this->clearChannelControlSubscription->disconnect(); // Disconnect all events.
+    // Deleting a subscription unsubscribes it.
+    delete this->stopControlSubscription;
+    delete this->playControlSubscription;
+    delete this->updateControlSubscription;
+    delete this->clearControlSubscription;
+    delete this->clearVideolayerControlSubscription;
+    delete this->clearChannelControlSubscription;
 
     QString stopControlFilter = Osc::DEFAULT_STOP_CONTROL_FILTER;
     stopControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->stopControlSubscription = new OscSubscription(stopControlFilter, this);
-    QObject::connect(this->stopControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(stopControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->stopControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(stopControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString playControlFilter = Osc::DEFAULT_PLAY_CONTROL_FILTER;
     playControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->playControlSubscription = new OscSubscription(playControlFilter, this);
-    QObject::connect(this->playControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(playControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->playControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(playControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString updateControlFilter = Osc::DEFAULT_UPDATE_CONTROL_FILTER;
     updateControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->updateControlSubscription = new OscSubscription(updateControlFilter, this);
-    QObject::connect(this->updateControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(updateControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->updateControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(updateControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearControlFilter = Osc::DEFAULT_CLEAR_CONTROL_FILTER;
     clearControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearControlSubscription = new OscSubscription(clearControlFilter, this);
-    QObject::connect(this->clearControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearVideolayerControlFilter = Osc::DEFAULT_CLEAR_VIDEOLAYER_CONTROL_FILTER;
     clearVideolayerControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearVideolayerControlSubscription = new OscSubscription(clearVideolayerControlFilter, this);
-    QObject::connect(this->clearVideolayerControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearVideolayerControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearVideolayerControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearVideolayerControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearChannelControlFilter = Osc::DEFAULT_CLEAR_CHANNEL_CONTROL_FILTER;
     clearChannelControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearChannelControlSubscription = new OscSubscription(clearChannelControlFilter, this);
-    QObject::connect(this->clearChannelControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearChannelControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearChannelControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearChannelControlSubscriptionReceived(const QString&, const OscArguments&)));
 }
 
 void RundownBrightnessWidget::allowGpiChanged(bool allowGpi)
@@ -456,37 +433,37 @@ void RundownBrightnessWidget::deviceAdded(CasparDevice& device)
     checkDeviceConnection();
 }
 
-void RundownBrightnessWidget::stopControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownBrightnessWidget::stopControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Stop);
 }
 
-void RundownBrightnessWidget::playControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownBrightnessWidget::playControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Play);
 }
 
-void RundownBrightnessWidget::updateControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownBrightnessWidget::updateControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Update);
 }
 
-void RundownBrightnessWidget::clearControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownBrightnessWidget::clearControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Clear);
 }
 
-void RundownBrightnessWidget::clearVideolayerControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownBrightnessWidget::clearVideolayerControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::ClearVideolayer);
 }
 
-void RundownBrightnessWidget::clearChannelControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownBrightnessWidget::clearChannelControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::ClearChannel);
@@ -88,13 +88,13 @@ class WIDGETS_EXPORT RundownClearOutputWidget : public QWidget, Ui::RundownClear
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
-        Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void nextControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void updateControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearVideolayerControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearChannelControlSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void stopControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void playControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void nextControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void updateControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearVideolayerControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearChannelControlSubscriptionReceived(const QString&, const OscArguments&);
         Q_SLOT void labelChanged(const LabelChangedEvent&);
         Q_SLOT void deviceChanged(const DeviceChangedEvent&);
 };
@@ -4,6 +4,7 @@
 
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
+#include "ThumbnailCache.h"
 #include "GpiManager.h"
 #include "EventManager.h"
 #include "Events/ConnectionStateChangedEvent.h"
@@ -20,8 +21,7 @@ RundownVideoWidget::RundownVideoWidget(const LibraryModel& model, QWidget* paren
                                        bool loaded, bool paused, bool playing, bool inGroup, bool compactView)
     : QWidget(parent),
       active(active), loaded(loaded), paused(paused), playing(playing), inGroup(inGroup), compactView(compactView), color(color), model(model),
-      fileModel(NULL), timeSubscription(NULL), frameSubscription(NULL), fpsSubscription(NULL), pathSubscription(NULL), pausedSubscription(NULL),
-      loopSubscription(NULL), stopControlSubscription(NULL), playControlSubscription(NULL), loadControlSubscription(NULL), pauseControlSubscription(NULL),
+      playbackStateSubscription(NULL), stopControlSubscription(NULL), playControlSubscription(NULL), loadControlSubscription(NULL), pauseControlSubscription(NULL),
       nextControlSubscription(NULL), updateControlSubscription(NULL), clearControlSubscription(NULL), clearVideolayerControlSubscription(NULL),
       clearChannelControlSubscription(NULL), animation(NULL), reverseOscTime(false), sendAutoPlay(false), hasSentAutoPlay(false)
 {
@@ -31,7 +31,6 @@ RundownVideoWidget::RundownVideoWidget(const LibraryModel& model, QWidget* paren
 
     this->delayType = DatabaseManager::getInstance().getConfigurationByName("DelayType").getValue();
 
-    setThumbnail();
     setColor(this->color);
     setActive(this->active);
     setCompactView(this->compactView);
@@ -70,7 +69,10 @@ RundownVideoWidget::RundownVideoWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL)
+    {
         QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(device.data(), SIGNAL(ipAddressChanged(CasparDevice&)), this, SLOT(deviceIpAddressChanged(CasparDevice&)));
+    }
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
 
@@ -137,7 +139,10 @@ void RundownVideoWidget::deviceChanged(const DeviceChangedEvent& event)
         // Disconnect connectionStateChanged() from the old device.
         const QSharedPointer<CasparDevice> oldDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (oldDevice != NULL)
+        {
             QObject::disconnect(oldDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::disconnect(oldDevice.data(), SIGNAL(ipAddressChanged(CasparDevice&)), this, SLOT(deviceIpAddressChanged(CasparDevice&)));
+        }
 
         // Update the model with the new device.
         this->model.setDeviceName(event.getDeviceName());
@@ -146,7 +151,10 @@ void RundownVideoWidget::deviceChanged(const DeviceChangedEvent& event)
         // Connect connectionStateChanged() to the new device.
         const QSharedPointer<CasparDevice> newDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (newDevice != NULL)
+        {
             QObject::connect(newDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::connect(newDevice.data(), SIGNAL(ipAddressChanged(CasparDevice&)), this, SLOT(deviceIpAddressChanged(CasparDevice&)));
+        }
     }
 
     checkEmptyDevice();
@@ -205,6 +213,8 @@ void RundownVideoWidget::setCompactView(bool compactView)
     this->widgetOscTime->setCompactView(compactView);
 
     this->compactView = compactView;
+
+    setThumbnail();
 }
 
 void RundownVideoWidget::readProperties(boost::property_tree::wptree& pt)
@@ -247,21 +257,20 @@ void RundownVideoWidget::setThumbnail()
         return;
     }
 
-    QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
-
-    /*
-    QString data = DatabaseManager::getInstance().getThumbnailById(this->model.getThumbnailId()).getData();
-    if (data.isEmpty())
-        data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
-    */
+    QPixmap pixmap;
+    QByteArray data;
+    if (!ThumbnailCache::getInstance().getThumbnail(this->model.getName(), this->model.getDeviceName(), this->compactView, pixmap, data, this, "setThumbnail"))
+    {
+        // Called again once the thumbnail has been decoded.
+        this->labelThumbnail->setPixmap(ThumbnailCache::getInstance().getPlaceholder(this->compactView));
+        return;
+    }
 
-    QImage image;
-    image.loadFromData(QByteArray::fromBase64(data.toAscii()), "PNG");
-    this->labelThumbnail->setPixmap(QPixmap::fromImage(image));
+    this->labelThumbnail->setPixmap(pixmap);
 
     bool displayThumbnailTooltip = (DatabaseManager::getInstance().getConfigurationByName("ShowThumbnailTooltip").getValue() == "true") ? true : false;
     if (displayThumbnailTooltip)
-        this->labelThumbnail->setToolTip(QString("<img src=\"data:image/png;base64,%1 \"/>").arg(data));
+        this->labelThumbnail->setToolTip(QString("<img src=\"data:image/png;base64,%1 \"/>").arg(QString(data.toBase64())));
 }
 
 void RundownVideoWidget::setActive(bool active)
@@ -332,7 +341,10 @@ bool RundownVideoWidget::executeCommand(Playout::PlayoutType::Type type)
                     this->executeTimer.setInterval(this->command.getDelay());
                 }
 
-                this->executeTimer.start();
+                if (this->executeTimer.interval() == 0 && DeviceManager::getInstance().isDeferringMixer())
+                    executePlay();
+                else
+                    this->executeTimer.start();
             }
         }
     }
@@ -368,13 +380,9 @@ void RundownVideoWidget::executeStop()
     if (device != NULL && device->isConnected())
         device->stopVideo(this->command.getChannel(), this->command.getVideolayer());
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
             deviceShadow->stopVideo(this->command.getChannel(), this->command.getVideolayer());
     }
 
@@ -417,13 +425,9 @@ void RundownVideoWidget::executePlay()
         }
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             if (this->loaded)
             {
@@ -471,13 +475,9 @@ void RundownVideoWidget::executePause()
             device->pauseVideo(this->command.getChannel(), this->command.getVideolayer());
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             if (this->paused)
                 deviceShadow->playVideo(this->command.getChannel(), this->command.getVideolayer());
@@ -502,13 +502,9 @@ void RundownVideoWidget::executeLoad()
                           this->command.getLoop(), this->command.getFreezeOnLoad(), false);
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             deviceShadow->loadVideo(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
                                     this->command.getTransition(), this->command.getDuration(), this->command.getTween(),
@@ -537,13 +533,9 @@ void RundownVideoWidget::executeNext()
 
         }
 
-        foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+        foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
         {
-            if (model.getShadow() == "No")
-                continue;
-
-            const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-            if (deviceShadow != NULL && deviceShadow->isConnected())
+            if (deviceShadow->isConnected())
             {
                 deviceShadow->playVideo(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
                                         this->command.getTransition(), this->command.getDuration(), this->command.getTween(),
@@ -569,13 +561,9 @@ void RundownVideoWidget::executeClearVideolayer()
     if (device != NULL && device->isConnected())
         device->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
             deviceShadow->clearVideolayer(this->command.getChannel(), this->command.getVideolayer());
     }
 
@@ -601,13 +589,9 @@ void RundownVideoWidget::executeClearChannel()
         device->clearMixerChannel(this->command.getChannel());
     }
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
+        if (deviceShadow->isConnected())
         {
             deviceShadow->clearChannel(this->command.getChannel());
             deviceShadow->clearMixerChannel(this->command.getChannel());
@@ -649,155 +633,97 @@ void RundownVideoWidget::checkDeviceConnection()
 
 void RundownVideoWidget::configureOscSubscriptions()
 {
-    if (DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName()) == NULL)
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
+    if (device == NULL)
         return;
 
-    if (this->timeSubscription != NULL)
-        this->timeSubscription->disconnect(); // Disconnect all events.
-
-    if (this->frameSubscription != NULL)
-        this->frameSubscription->disconnect(); // Disconnect all events.
-
-    if (this->fpsSubscription != NULL)
-        this->fpsSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pathSubscription != NULL)
-        this->pathSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pausedSubscription != NULL)
-        this->pausedSubscription->disconnect(); // Disconnect all events.
-
-    if (this->loopSubscription != NULL)
-        this->loopSubscription->disconnect(); // Disconnect all events.
-
-    if (this->stopControlSubscription != NULL)
-        this->stopControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->playControlSubscription != NULL)
-        this->playControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->loadControlSubscription != NULL)
-        this->loadControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pauseControlSubscription != NULL)
-        this->pauseControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->nextControlSubscription != NULL)
-        this->nextControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->updateControlSubscription != NULL)
-        this->updateControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearControlSubscription != NULL)
-        this->clearControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearVideolayerControlSubscription != NULL)
-        this->clearVideolayerControlSubscription->disconnect(); // Disconnect all events.
-
-    if (this->clearChannelControlSubscription != NULL)
-        this->clearChannelControlSubscription->disconnect(); // Disconnect all events.
-
-    QString timeFilter = Osc::DEFAULT_TIME_FILTER;
-    timeFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->timeSubscription = new OscSubscription(timeFilter, this);
-    QObject::connect(this->timeSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(timeSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString frameFilter = Osc::DEFAULT_FRAME_FILTER;
-    frameFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-               .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-               .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->frameSubscription = new OscSubscription(frameFilter, this);
-    QObject::connect(this->frameSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(frameSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString fpsFilter = Osc::DEFAULT_FPS_FILTER;
-    fpsFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-             .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-             .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->fpsSubscription = new OscSubscription(fpsFilter, this);
-    QObject::connect(this->fpsSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(fpsSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString pathFilter = Osc::DEFAULT_PATH_FILTER;
-    pathFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->pathSubscription = new OscSubscription(pathFilter, this);
-    QObject::connect(this->pathSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pathSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString pausedFilter = Osc::DEFAULT_PAUSED_FILTER;
-    pausedFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-                .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-                .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->pausedSubscription = new OscSubscription(pausedFilter, this);
-    QObject::connect(this->pausedSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pausedSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString loopFilter = Osc::DEFAULT_LOOP_FILTER;
-    loopFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->loopSubscription = new OscSubscription(loopFilter, this);
-    QObject::connect(this->loopSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(loopSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    // Resolved asynchronously, we are called again through deviceIpAddressChanged() once it is known.
+    const QString ipAddress = device->resolveIpAddress();
+
+    // Deleting a subscription unsubscribes it.
+    delete this->playbackStateSubscription;
+    delete this->stopControlSubscription;
+    delete this->playControlSubscription;
+    delete this->loadControlSubscription;
+    delete this->pauseControlSubscription;
+    delete this->nextControlSubscription;
+    delete this->updateControlSubscription;
+    delete this->clearControlSubscription;
+    delete this->clearVideolayerControlSubscription;
+    delete this->clearChannelControlSubscription;
+
+    this->playbackStateSubscription = NULL;
+    this->stopControlSubscription = NULL;
+    this->playControlSubscription = NULL;
+    this->loadControlSubscription = NULL;
+    this->pauseControlSubscription = NULL;
+    this->nextControlSubscription = NULL;
+    this->updateControlSubscription = NULL;
+    this->clearControlSubscription = NULL;
+    this->clearVideolayerControlSubscription = NULL;
+    this->clearChannelControlSubscription = NULL;
+
+    // Not resolved yet, or the lookup failed. Paths without an address would match the channel and layer on every server.
+    if (ipAddress.isEmpty())
+        return;
+
+    this->playbackStateSubscription = new PlaybackStateSubscription(ipAddress, this->command.getChannel(), this->command.getVideolayer(), this);
+    QObject::connect(this->playbackStateSubscription, SIGNAL(playbackStateChanged(const OscFileModel&)),
+                     this, SLOT(playbackStateChanged(const OscFileModel&)));
 
     QString stopControlFilter = Osc::DEFAULT_STOP_CONTROL_FILTER;
     stopControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->stopControlSubscription = new OscSubscription(stopControlFilter, this);
-    QObject::connect(this->stopControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(stopControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->stopControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(stopControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString playControlFilter = Osc::DEFAULT_PLAY_CONTROL_FILTER;
     playControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->playControlSubscription = new OscSubscription(playControlFilter, this);
-    QObject::connect(this->playControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(playControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->playControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(playControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString loadControlFilter = Osc::DEFAULT_LOAD_CONTROL_FILTER;
     loadControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->loadControlSubscription = new OscSubscription(loadControlFilter, this);
-    QObject::connect(this->loadControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(loadControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->loadControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(loadControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString pauseControlFilter = Osc::DEFAULT_PAUSE_CONTROL_FILTER;
     pauseControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->pauseControlSubscription = new OscSubscription(pauseControlFilter, this);
-    QObject::connect(this->pauseControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pauseControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->pauseControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(pauseControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString nextControlFilter = Osc::DEFAULT_NEXT_CONTROL_FILTER;
     nextControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->nextControlSubscription = new OscSubscription(nextControlFilter, this);
-    QObject::connect(this->nextControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(nextControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->nextControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(nextControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString updateControlFilter = Osc::DEFAULT_UPDATE_CONTROL_FILTER;
     updateControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->updateControlSubscription = new OscSubscription(updateControlFilter, this);
-    QObject::connect(this->updateControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(updateControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->updateControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(updateControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearControlFilter = Osc::DEFAULT_CLEAR_CONTROL_FILTER;
     clearControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearControlSubscription = new OscSubscription(clearControlFilter, this);
-    QObject::connect(this->clearControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearVideolayerControlFilter = Osc::DEFAULT_CLEAR_VIDEOLAYER_CONTROL_FILTER;
     clearVideolayerControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearVideolayerControlSubscription = new OscSubscription(clearVideolayerControlFilter, this);
-    QObject::connect(this->clearVideolayerControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearVideolayerControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearVideolayerControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearVideolayerControlSubscriptionReceived(const QString&, const OscArguments&)));
 
     QString clearChannelControlFilter = Osc::DEFAULT_CLEAR_CHANNEL_CONTROL_FILTER;
     clearChannelControlFilter.replace("#UID#", this->command.getRemoteTriggerId());
     this->clearChannelControlSubscription = new OscSubscription(clearChannelControlFilter, this);
-    QObject::connect(this->clearChannelControlSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(clearChannelControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(this->clearChannelControlSubscription, SIGNAL(subscriptionReceived(const QString&, const OscArguments&)),
+                     this, SLOT(clearChannelControlSubscriptionReceived(const QString&, const OscArguments&)));
 }
 
 void RundownVideoWidget::channelChanged(int channel)
@@ -846,80 +772,31 @@ void RundownVideoWidget::deviceConnectionStateChanged(CasparDevice& device)
     checkDeviceConnection();
 }
 
-void RundownVideoWidget::deviceAdded(CasparDevice& device)
+void RundownVideoWidget::deviceIpAddressChanged(CasparDevice& device)
 {
-    if (DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress()).getName() == this->model.getDeviceName())
-        QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
-
-    checkDeviceConnection();
     configureOscSubscriptions();
 }
 
-void RundownVideoWidget::timeSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::deviceAdded(CasparDevice& device)
 {
-    //qDebug() << predicate << " " << arguments;
-
-    if (this->fileModel != NULL)
+    if (DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress()).getName() == this->model.getDeviceName())
     {
-        delete this->fileModel;
-        this->fileModel = NULL;
+        QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(&device, SIGNAL(ipAddressChanged(CasparDevice&)), this, SLOT(deviceIpAddressChanged(CasparDevice&)));
     }
 
-    this->fileModel = new OscFileModel();
-    this->fileModel->setTime(arguments.at(0).toDouble());
-    this->fileModel->setTotalTime(arguments.at(1).toDouble());
-}
-
-void RundownVideoWidget::frameSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    //qDebug() << predicate << " " << arguments;
-
-    if (this->fileModel == NULL)
-        return;
-
-    this->fileModel->setFrame(arguments.at(0).toInt());
-    this->fileModel->setTotalFrames(arguments.at(1).toInt());
-}
-
-void RundownVideoWidget::fpsSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    //qDebug() << predicate << " " << arguments;
-
-    if (this->fileModel == NULL)
-        return;
-
-    this->fileModel->setFramesPerSecond(arguments.at(0).toInt());
+    checkDeviceConnection();
+    configureOscSubscriptions();
 }
 
-void RundownVideoWidget::pathSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::playbackStateChanged(const OscFileModel& state)
 {
-    //qDebug() << predicate << " " << arguments << "\n";
-
-    QString name = arguments.at(0).toString();
+    QString name = state.getPath();
     name.remove(name.lastIndexOf('.'), name.length()); // Remove extension.
 
     if (this->model.getName().toLower() != name.toLower())
         return; // Wrong file.
 
-    if (this->fileModel == NULL)
-        return;
-
-    this->fileModel->setPath(arguments.at(0).toString());
-
-    this->widgetOscTime->setProgress(this->fileModel->getFrame());
-
-    if (this->reverseOscTime && this->fileModel->getFrame() > 0)
-        this->widgetOscTime->setTime(this->fileModel->getTotalFrames() - this->fileModel->getFrame());
-    else
-        this->widgetOscTime->setTime(this->fileModel->getFrame());
-
-    if (this->command.getSeek() == 0 && this->command.getLength() == 0)
-        this->widgetOscTime->setInOutTime(0, this->fileModel->getTotalFrames());
-    else
-        this->widgetOscTime->setInOutTime(this->command.getSeek(), this->command.getLength());
-
-    this->widgetOscTime->setFramesPerSecond(this->fileModel->getFramesPerSecond());
-
     if (this->sendAutoPlay && !this->hasSentAutoPlay)
     {
         EventManager::getInstance().fireAutoPlayRundownItemEvent(AutoPlayRundownItemEvent(this));
@@ -927,20 +804,30 @@ void RundownVideoWidget::pathSubscriptionReceived(const QString& predicate, cons
         this->sendAutoPlay = false;
         this->hasSentAutoPlay = true;
 
-        qDebug() << "RundownVideoWidget::pathSubscriptionReceived: Dispatched AutoPlay event";
+        qDebug() << "RundownVideoWidget::playbackStateChanged: Dispatched AutoPlay event";
     }
 
     this->playing = true;
-}
 
-void RundownVideoWidget::pausedSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    this->widgetOscTime->setPaused(arguments.at(0).toBool());
-}
+    // Items scrolled out of view are not repainted, the next state brings them up to date again.
+    if (this->visibleRegion().isEmpty())
+        return;
 
-void RundownVideoWidget::loopSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    this->widgetOscTime->setLoop(arguments.at(0).toBool());
+    this->widgetOscTime->setFramesPerSecond(state.getFramesPerSecond());
+    this->widgetOscTime->setProgress(state.getFrame());
+
+    if (this->reverseOscTime && state.getFrame() > 0)
+        this->widgetOscTime->setTime(state.getTotalFrames() - state.getFrame());
+    else
+        this->widgetOscTime->setTime(state.getFrame());
+
+    if (this->command.getSeek() == 0 && this->command.getLength() == 0)
+        this->widgetOscTime->setInOutTime(0, state.getTotalFrames());
+    else
+        this->widgetOscTime->setInOutTime(this->command.getSeek(), this->command.getLength());
+
+    this->widgetOscTime->setPaused(state.getPaused());
+    this->widgetOscTime->setLoop(state.getLoop());
 }
 
 void RundownVideoWidget::autoPlayChanged(bool autoPlay)
@@ -948,55 +835,55 @@ void RundownVideoWidget::autoPlayChanged(bool autoPlay)
     this->labelAutoPlay->setVisible(autoPlay);
 }
 
-void RundownVideoWidget::stopControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::stopControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Stop);
 }
 
-void RundownVideoWidget::playControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::playControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Play);
 }
 
-void RundownVideoWidget::loadControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::loadControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Load);
 }
 
-void RundownVideoWidget::pauseControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::pauseControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Pause);
 }
 
-void RundownVideoWidget::nextControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::nextControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Next);
 }
 
-void RundownVideoWidget::updateControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::updateControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Update);
 }
 
-void RundownVideoWidget::clearControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::clearControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::Clear);
 }
 
-void RundownVideoWidget::clearVideolayerControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::clearVideolayerControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::ClearVideolayer);
 }
 
-void RundownVideoWidget::clearChannelControlSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownVideoWidget::clearChannelControlSubscriptionReceived(const QString& predicate, const OscArguments& arguments)
 {
     if (this->command.getAllowRemoteTriggering() && arguments.count() > 0 && arguments[0] == 1)
         executeCommand(Playout::PlayoutType::ClearChannel);
@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "PlaybackStateSubscription.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -74,13 +75,7 @@ class WIDGETS_EXPORT RundownVideoWidget : public QWidget, Ui::RundownVideoWidget
         bool hasSentAutoPlay;
         QString delayType;
 
-        OscFileModel* fileModel;
-        OscSubscription* timeSubscription;
-        OscSubscription* frameSubscription;
-        OscSubscription* fpsSubscription;
-        OscSubscription* pathSubscription;
-        OscSubscription* pausedSubscription;
-        OscSubscription* loopSubscription;
+        PlaybackStateSubscription* playbackStateSubscription;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -94,7 +89,7 @@ class WIDGETS_EXPORT RundownVideoWidget : public QWidget, Ui::RundownVideoWidget
 
         QTimer executeTimer;
 
-        void setThumbnail();
+        Q_SLOT void setThumbnail();
         void checkEmptyDevice();
         void checkGpiConnection();
         void checkDeviceConnection();
@@ -116,23 +111,19 @@ class WIDGETS_EXPORT RundownVideoWidget : public QWidget, Ui::RundownVideoWidget
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
+        Q_SLOT void deviceIpAddressChanged(CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
-        Q_SLOT void timeSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void frameSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void fpsSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pathSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pausedSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void loopSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void playbackStateChanged(const OscFileModel&);
         Q_SLOT void autoPlayChanged(bool);
-        Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void loadControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pauseControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void nextControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void updateControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearVideolayerControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void clearChannelControlSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void stopControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void playControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void loadControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void pauseControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void nextControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void updateControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearVideolayerControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void clearChannelControlSubscriptionReceived(const QString&, const OscArguments&);
         Q_SLOT void videolayerChanged(const VideolayerChangedEvent&);
         Q_SLOT void channelChanged(const ChannelChangedEvent&);
         Q_SLOT void labelChanged(const LabelChangedEvent&);
@@ -81,8 +81,8 @@ class WIDGETS_EXPORT RundownAutoWidget : public QWidget, Ui::RundownAutoWidget,
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void deviceConnectionStateChanged(TriCasterDevice&);
         Q_SLOT void deviceAdded(TriCasterDevice&);
-        Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void updateControlSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void playControlSubscriptionReceived(const QString&, const OscArguments&);
+        Q_SLOT void updateControlSubscriptionReceived(const QString&, const OscArguments&);
         Q_SLOT void preview(const PreviewEvent&);
         Q_SLOT void labelChanged(const LabelChangedEvent&);
         Q_SLOT void tricasterDeviceChanged(const TriCasterDeviceChangedEvent&);
@@ -0,0 +1,98 @@
+#include "ServerMonitorDialog.h"
+
+#include "DeviceManager.h"
+#include "OscDeviceManager.h"
+#include "ReconnectScheduler.h"
+#include "Models/DeviceModel.h"
+
+#include <QtCore/QDebug>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include <QtGui/QFileDialog>
+#include <QtGui/QTreeWidgetItem>
+
+ServerMonitorDialog::ServerMonitorDialog(QWidget* parent)
+    : QDialog(parent)
+{
+    setupUi(this);
+
+    this->treeWidgetServer->setColumnWidth(0, 120);
+
+    QObject::connect(this->pushButtonReset, SIGNAL(clicked()), this, SLOT(resetStatistics()));
+    QObject::connect(this->pushButtonSave, SIGNAL(clicked()), this, SLOT(saveStatistics()));
+
+    this->refreshTimer.setInterval(1000);
+    QObject::connect(&this->refreshTimer, SIGNAL(timeout()), this, SLOT(refreshStatistics()));
+    this->refreshTimer.start();
+
+    refreshStatistics();
+}
+
+void ServerMonitorDialog::refreshStatistics()
+{
+    const OscListener::OscListenerStatistics osc = OscDeviceManager::getInstance().getOscListener()->getStatistics();
+    this->labelOscSubscriptions->setText(QString("OSC subscriptions: %1 (%2 paths), received: %3, coalesced: %4, dropped: %5, control: %6 (%7 limited)")
+                                         .arg(OscDeviceManager::getInstance().getSubscriptionCount())
+                                         .arg(OscDeviceManager::getInstance().getRouteCount())
+                                         .arg(osc.received).arg(osc.coalesced).arg(osc.dropped).arg(osc.controls).arg(osc.limited));
+
+    QStringList sources;
+    foreach (const OscListener::OscListenerStatistics& source, OscDeviceManager::getInstance().getOscListener()->getSourceStatistics())
+        sources.append(QString("%1 received: %2, coalesced: %3, dropped: %4, control: %5 (%6 limited)").arg(source.address).arg(source.received)
+                                                                                                         .arg(source.coalesced).arg(source.dropped)
+                                                                                                         .arg(source.controls).arg(source.limited));
+
+    this->labelOscSubscriptions->setToolTip(sources.join("\n"));
+
+    this->treeWidgetServer->clear();
+
+    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    {
+        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(model.getName());
+        if (device == NULL)
+            continue;
+
+        const AmcpDevice::AmcpLatencyStatistics latency = device->getLatencyStatistics();
+        const ReconnectScheduler::ReconnectStatistics reconnects = ReconnectScheduler::getInstance().getStatistics(device.data());
+
+        QTreeWidgetItem* item = new QTreeWidgetItem(this->treeWidgetServer);
+        item->setText(0, model.getName());
+        item->setText(1, QString("%1:%2").arg(device->getAddress()).arg(device->getPort()));
+        item->setText(2, device->isConnected() ? "Connected" : "Disconnected");
+        item->setText(3, QString::number(latency.median / 1000.0, 'f', 1));
+        item->setText(4, QString::number(latency.percentile99 / 1000.0, 'f', 1));
+        item->setText(5, QString::number(latency.maximum / 1000.0, 'f', 1));
+        item->setText(6, QString::number(latency.samples));
+        item->setText(7, QString::number(latency.failures));
+        item->setText(8, QString::number(device->getPendingCount()));
+        item->setText(9, QString::number(reconnects.connects > 0 ? reconnects.connects - 1 : 0));
+    }
+}
+
+void ServerMonitorDialog::resetStatistics()
+{
+    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    {
+        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(model.getName());
+        if (device != NULL)
+            device->resetLatencyStatistics();
+    }
+
+    refreshStatistics();
+}
+
+void ServerMonitorDialog::saveStatistics()
+{
+    const QString path = QFileDialog::getSaveFileName(this, "Save Statistics", "", "Statistics (*.json)");
+    if (path.isEmpty())
+        return;
+
+    QFile file(path);
+    if (file.open(QFile::WriteOnly | QFile::Truncate))
+    {
+        file.write(DeviceManager::getInstance().dumpStatistics().toUtf8());
+        file.close();
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Shared.h"
+#include "ui_ServerMonitorDialog.h"
+
+#include <QtCore/QTimer>
+
+#include <QtGui/QDialog>
+#include <QtGui/QWidget>
+
+class WIDGETS_EXPORT ServerMonitorDialog : public QDialog, Ui::ServerMonitorDialog
+{
+    Q_OBJECT
+
+    public:
+        explicit ServerMonitorDialog(QWidget* parent = 0);
+
+    private:
+        QTimer refreshTimer;
+
+        Q_SLOT void refreshStatistics();
+        Q_SLOT void resetStatistics();
+        Q_SLOT void saveStatistics();
+};
@@ -758,7 +758,7 @@ void SettingsDialog::oscPortChanged()
 {
     QString oscPort = this->lineEditOscInputPort->text().trimmed();
     if (oscPort.isEmpty())
-        oscPort = Osc::DEFAULT_PORT;
+        oscPort = QString("%1").arg(Osc::DEFAULT_PORT);
 
     qDebug() << "OSC port: " << oscPort;
 
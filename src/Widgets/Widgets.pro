@@ -18,6 +18,7 @@ HEADERS += \
     AboutDialog.h \
     Shared.h \
     HelpDialog.h \
+    ServerMonitorDialog.h \
     Inspector/InspectorWidget.h \
     Inspector/InspectorTemplateWidget.h \
     Inspector/InspectorOutputWidget.h \
@@ -137,6 +138,7 @@ SOURCES += \
     AboutDialog.cpp \
     MainWindow.cpp \
     HelpDialog.cpp \
+    ServerMonitorDialog.cpp \
     Inspector/InspectorWidget.cpp \
     Inspector/InspectorTemplateWidget.cpp \
     Inspector/InspectorOutputWidget.cpp \
@@ -255,6 +257,7 @@ FORMS += \
     PreviewWidget.ui \
     AboutDialog.ui \
     HelpDialog.ui \
+    ServerMonitorDialog.ui \
     Inspector/InspectorVolumeWidget.ui \
     Inspector/InspectorWidget.ui \
     Inspector/InspectorTemplateWidget.ui \